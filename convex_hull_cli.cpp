@@ -0,0 +1,377 @@
+/**
+ * @file convex_hull_cli.cpp
+ * @brief Contains the entry point for the command line tool, which computes the convex hull of a file of points
+ * without opening a window so that it can run in shell pipelines and batch jobs.
+ *
+ * Usage: convex_hull_cli [options] [input file]
+ *
+ * The points are read from the input file, or from the standard input when there is none or it is "-", in the
+ * "(x, y)" text format or the binary point format, and the points on the hull are written to the standard output.
+ *
+ */
+#include "approximate_hull_engine.h"
+#include "chan_engine.h"
+#include "convex_layers_engine.h"
+#include "hull_prefilter.h"
+#include "jarvis_march_engine.h"
+#include "kirk_patrick_seidel_engine.h"
+#include "monotone_chain_engine.h"
+#include "point_file_reader.h"
+#include "point_file_writer.h"
+#include "quick_hull_engine.h"
+#include "task_scheduler.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The algorithms that can compute the hull.
+ *
+ */
+const char *ALGORITHMS[] = {"jarvis-march", "kirkpatrick-seidel", "monotone-chain", "chan",
+                            "quickhull",    "approximate",        "convex-layers"};
+
+/**
+ * @brief Represents the options given on the command line.
+ *
+ */
+struct Options
+{
+    /**
+     * @brief The path of the input file, "-" for the standard input.
+     *
+     */
+    std::string inputFilePath = "-";
+    /**
+     * @brief The path of the output file, "-" for the standard output.
+     *
+     */
+    std::string outputFilePath = "-";
+    /**
+     * @brief The algorithm computing the hull, one of ALGORITHMS.
+     *
+     */
+    std::string algorithm = "monotone-chain";
+    /**
+     * @brief The number of worker threads of the shared TaskScheduler, 0 for one per hardware thread.
+     *
+     */
+    int threads = 0;
+    /**
+     * @brief Whether the interior points are discarded by a HullPrefilter before the hull is computed.
+     *
+     */
+    bool prefilter = false;
+    /**
+     * @brief Whether the hull is computed even when the input is a binary point file holding a precomputed one.
+     *
+     */
+    bool recompute = false;
+    /**
+     * @brief The format of the output.
+     *
+     */
+    PointFileWriter::Format format = PointFileWriter::TEXT;
+    /**
+     * @brief The number of digits after the decimal point, or PointFileWriter::SHORTEST.
+     *
+     */
+    int precision = PointFileWriter::SHORTEST;
+    /**
+     * @brief Whether the timings are printed to the standard error.
+     *
+     */
+    bool stats = false;
+};
+
+/**
+ * @brief Prints how to use the tool.
+ *
+ * @param ostream The stream to print to.
+ */
+void printUsage(std::ostream &ostream)
+{
+    ostream << "Usage: convex_hull_cli [options] [input file]\n"
+               "Reads points in the \"(x, y)\" text format or the binary point format from the input file, or from\n"
+               "the standard input when there is none or it is \"-\", and writes the points on the convex hull.\n"
+               "\n"
+               "Options:\n"
+               "  -a, --algorithm NAME  the algorithm computing the hull, monotone-chain by default, one of:\n"
+               "                        ";
+    for (const char *algorithm : ALGORITHMS)
+    {
+        ostream << (algorithm == ALGORITHMS[0] ? "" : ", ") << algorithm;
+    }
+    ostream << "\n";
+    ostream << "                        convex-layers writes every layer followed by an empty line\n"
+               "  -t, --threads N       the number of worker threads, one per hardware thread by default\n"
+               "  -p, --prefilter       discard the interior points before computing the hull\n"
+               "  -r, --recompute       compute the hull even when a binary input holds a precomputed one, which\n"
+               "                        is otherwise written as it is by every algorithm but the last two\n"
+               "  -f, --format FORMAT   text for \"(x,y)\" lines, the default, or csv for \"x,y\" lines with a header\n"
+               "      --precision N     the digits after the decimal point, the shortest exact form by default\n"
+               "  -o, --output FILE     the file to write the hull to, the standard output by default\n"
+               "  -s, --stats           print the number of points and the timings to the standard error\n"
+               "  -h, --help            print this message\n";
+}
+
+/**
+ * @brief Parses a non-negative integer option.
+ *
+ * @param text The value of the option.
+ * @param largest The largest value allowed.
+ * @param value Set to the integer.
+ * @return true If the value is an integer from 0 to largest.
+ * @return false otherwise.
+ */
+bool parseCount(const char *text, int largest, int &value)
+{
+    char *end;
+    long parsed = std::strtol(text, &end, 10);
+    if (*text == '\0' || *end != '\0' || parsed < 0 || parsed > largest)
+        return false;
+    value = parsed;
+    return true;
+}
+
+/**
+ * @brief Parses the command line.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments.
+ * @param options Set to the options.
+ * @param error Set to what is wrong with the command line.
+ * @return true If the command line is valid.
+ * @return false otherwise.
+ */
+bool parseOptions(int argc, char **argv, Options &options, std::string &error)
+{
+    bool inputGiven = false;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string argument = argv[i];
+        bool takesValue = argument == "-a" || argument == "--algorithm" || argument == "-t" ||
+                          argument == "--threads" || argument == "-f" || argument == "--format" ||
+                          argument == "--precision" || argument == "-o" || argument == "--output";
+        if (takesValue && i + 1 == argc)
+        {
+            error = "missing the value of " + argument;
+            return false;
+        }
+
+        if (argument == "-a" || argument == "--algorithm")
+        {
+            options.algorithm = argv[++i];
+            bool known = false;
+            for (const char *algorithm : ALGORITHMS)
+                known |= options.algorithm == algorithm;
+            if (!known)
+            {
+                error = "unknown algorithm " + options.algorithm;
+                return false;
+            }
+        }
+        else if (argument == "-t" || argument == "--threads")
+        {
+            if (!parseCount(argv[++i], 1024, options.threads))
+            {
+                error = "expected a number of threads, found " + std::string(argv[i]);
+                return false;
+            }
+        }
+        else if (argument == "-p" || argument == "--prefilter")
+            options.prefilter = true;
+        else if (argument == "-r" || argument == "--recompute")
+            options.recompute = true;
+        else if (argument == "-f" || argument == "--format")
+        {
+            std::string format = argv[++i];
+            if (format == "text")
+                options.format = PointFileWriter::TEXT;
+            else if (format == "csv")
+                options.format = PointFileWriter::CSV;
+            else
+            {
+                error = "unknown format " + format;
+                return false;
+            }
+        }
+        else if (argument == "--precision")
+        {
+            if (!parseCount(argv[++i], 32, options.precision))
+            {
+                error = "expected a number of digits, found " + std::string(argv[i]);
+                return false;
+            }
+        }
+        else if (argument == "-o" || argument == "--output")
+            options.outputFilePath = argv[++i];
+        else if (argument == "-s" || argument == "--stats")
+            options.stats = true;
+        else if (argument.size() > 1 && argument[0] == '-')
+        {
+            error = "unknown option " + argument;
+            return false;
+        }
+        else if (inputGiven)
+        {
+            error = "more than one input file";
+            return false;
+        }
+        else
+        {
+            options.inputFilePath = argument;
+            inputGiven = true;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Computes the hull of the points with the chosen algorithm.
+ *
+ * @param algorithm The algorithm, one of ALGORITHMS.
+ * @param points The points.
+ * @param writer The writer the points on the hull are added to.
+ * @return size_t The number of points written.
+ */
+size_t computeHull(const std::string &algorithm, std::vector<Vector2> points, PointFileWriter &writer)
+{
+    std::vector<Vector2> hull;
+    if (algorithm == "jarvis-march")
+        hull = JarvisMarchEngine<NoRecord>(std::move(points)).getConvexHull();
+    else if (algorithm == "kirkpatrick-seidel")
+        hull = KirkpatrickSeidelEngine<NoRecord>(std::move(points)).getConvexHull();
+    else if (algorithm == "monotone-chain")
+        hull = MonotoneChainEngine<NoRecord>(std::move(points)).getConvexHull();
+    else if (algorithm == "chan")
+        hull = ChanEngine<NoRecord>(std::move(points)).getConvexHull();
+    else if (algorithm == "quickhull")
+        hull = QuickHullEngine<NoRecord>(std::move(points)).getConvexHull();
+    else if (algorithm == "approximate")
+        hull = ApproximateHullEngine<NoRecord>(std::move(points)).getConvexHull();
+    else
+    {
+        // the layers are written one after the other, every one of them followed by an empty line
+        ConvexLayersEngine<NoRecord> engine(std::move(points));
+        size_t count = 0;
+        for (int layer = 0; layer < engine.getLayerCount(); layer++)
+        {
+            std::vector<Vector2> layerPoints = engine.getLayer(layer);
+            writer.addPoints(layerPoints);
+            writer.addBlankLine();
+            count += layerPoints.size();
+        }
+        return count;
+    }
+    writer.addPoints(hull);
+    return hull.size();
+}
+
+/**
+ * @brief Program main entry point.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments.
+ * @return int 0 on success, 1 if the points could not be read or the hull could not be written, 2 if the command line
+ * is invalid.
+ */
+int main(int argc, char **argv)
+{
+    Options options;
+    std::string error;
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "-h") == 0 || std::strcmp(argv[i], "--help") == 0)
+        {
+            printUsage(std::cout);
+            return 0;
+        }
+    }
+    if (!parseOptions(argc, argv, options, error))
+    {
+        std::cerr << "convex_hull_cli: " << error << "\nTry 'convex_hull_cli --help' for more information.\n";
+        return 2;
+    }
+    TaskScheduler::setSharedThreadCount(options.threads);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Vector2> points;
+    PointFileReader reader;
+    const std::string inputFilePath = options.inputFilePath == "-" ? "/dev/stdin" : options.inputFilePath;
+    if (!reader.open(inputFilePath))
+    {
+        std::cerr << reader.getError() << "\n";
+        return 1;
+    }
+
+    // a hull stored in a binary file is the exact hull, written as it is without reading the points, and the
+    // prefilter reads the co-ordinates of a binary file straight from the mapping, so only the points it keeps are
+    // copied
+    const BinaryPointFile *binaryFile = reader.getBinaryFile();
+    bool exact = options.algorithm != "approximate" && options.algorithm != "convex-layers";
+    bool storedHull = binaryFile != nullptr && binaryFile->hasHull() && exact && !options.recompute;
+    bool mappedPrefilter = binaryFile != nullptr && binaryFile->getXs() != nullptr && options.prefilter;
+    size_t pointCount = 0, discardedCount = 0;
+    if (binaryFile != nullptr && (storedHull || mappedPrefilter))
+        pointCount = binaryFile->getCount();
+    else if (!reader.readAll(points))
+    {
+        std::cerr << reader.getError() << "\n";
+        return 1;
+    }
+    else
+        pointCount = points.size();
+    auto read = std::chrono::steady_clock::now();
+
+    if (options.prefilter && !storedHull)
+    {
+        HullPrefilter prefilter;
+        if (mappedPrefilter)
+            points = prefilter.filter(binaryFile->getXs(), binaryFile->getYs(), static_cast<int>(pointCount));
+        else
+            points = prefilter.filter(points);
+        discardedCount = prefilter.getDiscardedCount();
+    }
+    auto filtered = std::chrono::steady_clock::now();
+
+    PointFileWriter writer(options.format, options.precision);
+    size_t hullCount;
+    if (storedHull)
+    {
+        std::vector<Vector2> hull = binaryFile->getHull();
+        writer.addPoints(hull);
+        hullCount = hull.size();
+    }
+    else
+        hullCount = computeHull(options.algorithm, std::move(points), writer);
+    auto computed = std::chrono::steady_clock::now();
+
+    bool written = options.outputFilePath == "-" ? writer.print() : writer.save(options.outputFilePath);
+    if (!written)
+    {
+        std::cerr << writer.getError() << "\n";
+        return 1;
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    if (options.stats)
+    {
+        auto seconds = [](auto from, auto to) { return std::chrono::duration<double>(to - from).count(); };
+        std::cerr << std::fixed << std::setprecision(4) << "read:      " << pointCount << " points in "
+                  << seconds(start, read) << " s\n";
+        if (options.prefilter && !storedHull)
+            std::cerr << "prefilter: " << discardedCount << " points discarded in " << seconds(read, filtered)
+                      << " s\n";
+        std::cerr << "hull:      " << hullCount << " points by " << (storedHull ? "the file" : options.algorithm)
+                  << " in " << seconds(filtered, computed) << " s\n"
+                  << "threads:   " << TaskScheduler::shared().getThreadCount() << "\n"
+                  << "write:     " << writer.getSize() << " bytes in " << seconds(computed, end) << " s\n"
+                  << "total:     " << seconds(start, end) << " s\n";
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,173 @@
+/**
+ * @file approximate_hull.h
+ * @brief Contains the declaration of the ApproximateHull class.
+ *
+ * This class computes an approximate convex hull of a set of points as a quick preview of the exact one.
+ *
+ */
+#ifndef APPROXIMATE_HULL_H
+#define APPROXIMATE_HULL_H
+
+#include "approximate_hull_engine.h"
+#include "convex_hull.h"
+#include <atomic>
+#include <future>
+
+/**
+ * @brief Represents the ApproximateHull class, computing the approximate convex hull of Bentley, Faust and Preparata
+ * and, when asked to, refining it to the exact convex hull in the background.
+ *
+ * The computation itself is done by ApproximateHullEngine, with every step recorded, while this class draws the
+ * recorded steps: the strips, the lowest and highest point found in each of them, and the hull of those points. The
+ * exact hull is computed by KirkpatrickSeidelEngine on another thread, and replaces the approximate one in the last
+ * step once it is ready. On the web there are no threads, so it is computed when the last step is first drawn.
+ *
+ * Usage:
+ * 1. Create an instance of the ApproximateHull class with the points to be used to compute the convex hull. The
+ * approximate convex hull is computed in the constructor.
+ * 2. Call the next() or previous() method to get the next or previous step in the convex hull computation process.
+ * 3. Call the draw() method to draw the current step of the convex hull computation process.
+ *
+ */
+class ApproximateHull : public ConvexHullAlgorithm, private ApproximateHullEngine<Record>
+{
+  public:
+    /**
+     * @brief The number of strips, few enough for every strip to be seen.
+     *
+     */
+    static const int STRIP_COUNT = 16;
+
+    /**
+     * @brief Constructs a new ApproximateHull object.
+     *
+     * @param p Set of input points.
+     * @param refine Whether to compute the exact convex hull in the background.
+     */
+    ApproximateHull(std::vector<Vector2> p, bool refine);
+    /**
+     * @brief Destroys the ApproximateHull object, cancelling the exact convex hull if it is still being computed. The
+     * computation stops at the next level of its recursion, so the destructor does not wait for all of it.
+     *
+     */
+    ~ApproximateHull();
+
+    /**
+     * @brief Draws the ApproximateHull::currentStep of the ApproximateHull object.
+     *
+     */
+    void draw();
+    /**
+     * @brief Gets the next step of the ApproximateHull object.
+     *
+     */
+    void next();
+    /**
+     * @brief Gets the previous step of the ApproximateHull object.
+     *
+     */
+    void previous();
+    /**
+     * @brief Checks if the ApproximateHull object has reached the last step in ApproximateHull::steps.
+     *
+     * @return true If the ApproximateHull object has reached the last step.
+     * @return false If the ApproximateHull object has not reached the last step.
+     */
+    bool isFinished();
+    /**
+     * @brief Gets the Number Of Steps in the convex hull computation.
+     *
+     * @return int number of steps.
+     */
+    int getNumberOfSteps();
+    /**
+     * @brief Gets the Current Step that is being drawn.
+     *
+     * @return int The current step.
+     */
+    int getCurrentStep();
+    /**
+     * @brief Sets the current step to the specified value.
+     *
+     * @param step The value to set the current step to.
+     */
+    void setCurrentStep(int step);
+    /**
+     * @brief Shows the legend for the visualization of the ApproximateHull computation.
+     *
+     * @param showLegend The variable used to indicate if the legend is to be displayed.
+     * @param windowPosition The position of the legend window on the screen.
+     * @param windowSize The size of the legend window.
+     * @param maxWindowSize The size of the legend window in the maximized state.
+     * @param contentSize The size of the content window inside the legend window.
+     * @param scroll The object used to keep track of current position after scrolling.
+     * @param moving The variable used to indicate if the floating window is moving.
+     * @param resizing The variable used to indicate if the floating window is resizing.
+     * @param minimized The variable used to indicate if the floating window is minimized.
+     * @param toolbarHeight The height of the toolbar.
+     * @param bottomBarHeight The height of the bottomBar.
+     * @param title The title for the floating window.
+     */
+    void showLegend(bool *showLegend, Vector2 *windowPosition, Vector2 *windowSize, Vector2 *maxWindowSize,
+                    Vector2 *contentSize, Vector2 *scroll, bool *moving, bool *resizing, bool *minimized,
+                    float toolbarHeight, float bottomBarHeight, const char *title);
+    /**
+     * @brief Gets all the points on the final convex hull.
+     *
+     * @return std::vector<Vector2> All the points on the exact convex hull once it has been computed, or else on the
+     * approximate convex hull.
+     */
+    std::vector<Vector2> exportHull();
+
+  private:
+    /**
+     * @brief Takes the exact convex hull once it has been computed.
+     *
+     * @return true If the exact convex hull is available.
+     * @return false otherwise.
+     */
+    bool pollRefinement();
+    /**
+     * @brief Draws a closed polygon.
+     *
+     * @param polygon The corners of the polygon.
+     * @param lineColor The color of the edges.
+     * @param pointColor The color of the corners.
+     */
+    void drawPolygon(const std::vector<Vector2> &polygon, Color lineColor, Color pointColor);
+    /**
+     * @brief Draws the lowest and highest points found in the strips up to a strip, and of the left most and right
+     * most points.
+     *
+     * @param lastStrip The index of the last strip to draw the points of.
+     */
+    void drawCandidates(int lastStrip);
+
+    /**
+     * @brief The current step in the visualization process.
+     *
+     */
+    int currentStep = 0;
+    /**
+     * @brief Set to stop the computation of the exact convex hull, declared before ApproximateHull::refinement so that
+     * it outlives it.
+     */
+    std::atomic<bool> cancelled{false};
+    /**
+     * @brief The exact convex hull being computed in the background, invalid once it has been taken.
+     *
+     */
+    std::future<std::vector<Vector2>> refinement;
+    /**
+     * @brief The exact convex hull, once it has been computed.
+     *
+     */
+    std::vector<Vector2> exactHull;
+    /**
+     * @brief Whether ApproximateHull::exactHull has been computed.
+     *
+     */
+    bool refined = false;
+};
+
+#endif // APPROXIMATE_HULL_H
\ No newline at end of file
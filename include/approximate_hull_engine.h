@@ -0,0 +1,193 @@
+/**
+ * @file approximate_hull_engine.h
+ * @brief Contains the declaration of the ApproximateHullEngine class template.
+ *
+ * This class implements the approximate convex hull of Bentley, Faust and Preparata without any drawing, so that it
+ * can be used both by the visualizer and by headless programs.
+ *
+ */
+#ifndef APPROXIMATE_HULL_ENGINE_H
+#define APPROXIMATE_HULL_ENGINE_H
+
+#include "raylib.h"
+#include "step_recording.h"
+#include <vector>
+
+/**
+ * @brief Represents the ApproximateHullEngine class, computing a convex hull that every point is within a known
+ * distance of, in linear time.
+ *
+ * The range of x co-ordinates of the points is cut into a number of vertical strips of equal width. One pass over the
+ * points finds the lowest and the highest point of every strip, which together with the lowest and highest of the
+ * left most and right most points are at most twice the number of strips plus four candidates. Their hull, computed
+ * with MonotoneChainEngine, is the approximate hull.
+ *
+ * Its corners lie on the edges of the exact hull, though not always at its corners, as a strip can hold a point in the
+ * middle of an edge but not the corner at its end. Every point is within the width of a strip of it: the point lies
+ * between the lowest and highest point of its strip, and the edge of the approximate hull joining them is less than a
+ * strip away horizontally. So the Hausdorff distance to the exact hull is at most getErrorBound().
+ *
+ * Both the pass finding the range and the pass over the strips work on fixed size chunks spread over the workers of
+ * the shared TaskScheduler.
+ *
+ * Usage:
+ * 1. Create an instance of the ApproximateHullEngine class with the points to be used to compute the convex hull and
+ * the number of strips. The convex hull is computed in the constructor.
+ * 2. Call the getConvexHull() method to get the points on the approximate convex hull.
+ *
+ * @tparam Recording The step recording policy, Record to record the steps for the visualizer or NoRecord to skip them.
+ */
+template <typename Recording> class ApproximateHullEngine
+{
+  public:
+    /**
+     * @brief Represents the kind of a step in the algorithm.
+     *
+     */
+    enum StepType
+    {
+        RANGE,
+        STRIP,
+        HULL,
+        FINISH
+    };
+
+    /**
+     * @brief The number of strips used by default.
+     *
+     */
+    static const int DEFAULT_STRIP_COUNT = 1024;
+    /**
+     * @brief The number of points in a chunk handed to a worker.
+     *
+     */
+    static const int CHUNK_SIZE = 1 << 16;
+
+    /**
+     * @brief Constructs a new Approximate Hull Engine object and computes the approximate convex hull.
+     *
+     * @param p Set of input points.
+     * @param stripCount The number of strips, at least 1. More strips give a smaller error for more candidates.
+     */
+    ApproximateHullEngine(std::vector<Vector2> p, int stripCount = DEFAULT_STRIP_COUNT);
+    /**
+     * @brief Gets all the points on the approximate convex hull.
+     *
+     * @return const std::vector<Vector2>& All the points on the approximate convex hull, in the same order as
+     * MonotoneChainEngine.
+     */
+    const std::vector<Vector2> &getConvexHull() const;
+    /**
+     * @brief Gets the largest distance from a point to the approximate convex hull, the width of a strip.
+     *
+     * @return float The error bound.
+     */
+    float getErrorBound() const;
+
+  protected:
+    /**
+     * @brief Represents information about a step in the algorithm.
+     *
+     */
+    struct ApproximateHullStep
+    {
+        /**
+         * @brief The kind of the step.
+         *
+         */
+        StepType type;
+        /**
+         * @brief The index of the strip whose candidates were found, -1 if there is none.
+         *
+         */
+        int strip;
+    };
+
+    /**
+     * @brief Computes the approximate convex hull, recording all the steps in the process if the policy asks for it.
+     *
+     */
+    void computeConvexHull();
+    /**
+     * @brief Finds the range of x co-ordinates.
+     *
+     */
+    void findRange();
+    /**
+     * @brief Finds the lowest and the highest point of every strip, and of the left most and the right most points.
+     *
+     */
+    void findStripExtremes();
+    /**
+     * @brief Gets the strip a point falls in.
+     *
+     * @param p The point.
+     * @return int The index of the strip.
+     */
+    int stripOf(Vector2 p) const;
+    /**
+     * @brief Gets the x co-ordinate of the left side of a strip.
+     *
+     * @param strip The index of the strip, up to the number of strips for the right side of the last one.
+     * @return float The x co-ordinate.
+     */
+    float stripLeft(int strip) const;
+
+    /**
+     * @brief The collection of points to be used to compute the convex hull.
+     *
+     */
+    std::vector<Vector2> points;
+    /**
+     * @brief The number of strips.
+     *
+     */
+    int stripCount;
+    /**
+     * @brief The smallest x co-ordinate of the points.
+     *
+     */
+    float minX = 0;
+    /**
+     * @brief The largest x co-ordinate of the points.
+     *
+     */
+    float maxX = 0;
+    /**
+     * @brief The width of a strip.
+     *
+     */
+    float stripWidth = 0;
+    /**
+     * @brief The inverse of the width of a strip, 0 when all the points have the same x co-ordinate.
+     *
+     */
+    float stripScale = 0;
+    /**
+     * @brief The indices of the lowest and the highest of the left most points, then of the right most points.
+     *
+     */
+    int sideExtremes[4] = {-1, -1, -1, -1};
+    /**
+     * @brief The index of the lowest point of every strip, -1 for an empty strip.
+     *
+     */
+    std::vector<int> stripLow;
+    /**
+     * @brief The index of the highest point of every strip, -1 for an empty strip.
+     *
+     */
+    std::vector<int> stripHigh;
+    /**
+     * @brief The calculated approximate convex hull.
+     *
+     */
+    std::vector<Vector2> hull;
+    /**
+     * @brief Holds the steps in the computation of the convex hull, only filled when recording.
+     *
+     */
+    std::vector<ApproximateHullStep> steps;
+};
+
+#endif // APPROXIMATE_HULL_ENGINE_H
\ No newline at end of file
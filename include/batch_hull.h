@@ -0,0 +1,193 @@
+/**
+ * @file batch_hull.h
+ * @brief Contains the declaration of the BatchHull class.
+ *
+ * This class computes the convex hulls of many small sets of points in one call.
+ *
+ */
+#ifndef BATCH_HULL_H
+#define BATCH_HULL_H
+
+#include <vector>
+
+/**
+ * @brief Represents the BatchHull class, computing the convex hull of every set in a batch of point sets with the
+ * monotone chain algorithm.
+ *
+ * The batch is given as structure of arrays: one buffer of x co-ordinates, one of y co-ordinates, and the offset of the
+ * first point of every set in them, so no per set object, copy of the points or record of steps is ever made. The sets
+ * are grouped into chunks of about the grain size in points, spread over the workers of the shared TaskScheduler.
+ *
+ * Sets of up to SMALL_SET_SIZE points are copied to the stack and sorted by insertion, which beats a general sort at
+ * that size and needs no memory from the heap. Larger sets sort their indices with std::sort in buffers reused by the
+ * whole chunk. A set is always done by one worker, so very large sets should go to the other engines instead.
+ *
+ * The hulls are the same as those of MonotoneChainEngine: points that lie on an edge of the hull are not part of it,
+ * duplicate points are only taken once, and every hull goes clockwise with y pointing up from its smallest point.
+ *
+ * Usage:
+ * 1. Create an instance of the BatchHull class.
+ * 2. Call compute() with the co-ordinates and offsets of the sets.
+ * 3. Call getIndices() and getHullOffsets() to get the hull of every set.
+ *
+ */
+class BatchHull
+{
+  public:
+    /**
+     * @brief Sets with up to this many points are handled by the small set kernel.
+     *
+     */
+    static const int SMALL_SET_SIZE = 64;
+    /**
+     * @brief The number of points in a chunk handed to a worker by default.
+     *
+     */
+    static const int DEFAULT_GRAIN_SIZE = 1 << 14;
+
+    /**
+     * @brief Constructs a new Batch Hull object.
+     *
+     * @param grainSize The number of points after which a chunk of sets is closed and handed to a worker.
+     */
+    BatchHull(int grainSize = DEFAULT_GRAIN_SIZE);
+    /**
+     * @brief Computes the convex hull of every set.
+     *
+     * @param xs The x co-ordinates of the points of all the sets.
+     * @param ys The y co-ordinates of the points of all the sets.
+     * @param offsets setCount + 1 non-decreasing offsets into xs and ys, set i being made of the points from
+     * offsets[i] to offsets[i + 1] - 1.
+     * @param setCount The number of sets.
+     */
+    void compute(const float *xs, const float *ys, const int *offsets, int setCount);
+    /**
+     * @brief Gets the hulls of all the sets computed by the last call to compute(), one after the other.
+     *
+     * @return const std::vector<int>& The index in xs and ys of every point on every hull.
+     */
+    const std::vector<int> &getIndices() const;
+    /**
+     * @brief Gets where the hull of every set starts in getIndices().
+     *
+     * @return const std::vector<int>& setCount + 1 offsets, the hull of set i being made of the indices from
+     * offsets[i] to offsets[i + 1] - 1.
+     */
+    const std::vector<int> &getHullOffsets() const;
+
+  private:
+    /**
+     * @brief Represents a point copied out of the input buffers along with its index there, so that the points of a
+     * set are sorted by value.
+     *
+     */
+    struct IndexedPoint
+    {
+        /**
+         * @brief The x co-ordinate.
+         *
+         */
+        float x;
+        /**
+         * @brief The y co-ordinate.
+         *
+         */
+        float y;
+        /**
+         * @brief The index of the point in the input buffers.
+         *
+         */
+        int index;
+    };
+    /**
+     * @brief Represents the buffers a worker reuses for all the large sets of a chunk.
+     *
+     */
+    struct Scratch
+    {
+        /**
+         * @brief The points of the set being worked on.
+         *
+         */
+        std::vector<IndexedPoint> points;
+        /**
+         * @brief The lower chain.
+         *
+         */
+        std::vector<int> lower;
+    };
+
+    /**
+     * @brief Computes the cross product of the vectors from o to a and from o to b, positive when o, a and b turn
+     * counter-clockwise with y pointing up.
+     *
+     * @param ox The x co-ordinate of the common origin.
+     * @param oy The y co-ordinate of the common origin.
+     * @param ax The x co-ordinate of the end of the first vector.
+     * @param ay The y co-ordinate of the end of the first vector.
+     * @param bx The x co-ordinate of the end of the second vector.
+     * @param by The y co-ordinate of the end of the second vector.
+     * @return float The cross product.
+     */
+    static float cross(float ox, float oy, float ax, float ay, float bx, float by);
+    /**
+     * @brief Compares two points by x co-ordinate, and then by y co-ordinate.
+     *
+     * @param a The first point.
+     * @param b The second point.
+     * @return true if (a < b).
+     * @return false otherwise.
+     */
+    static bool compareIndexedPoint(const IndexedPoint &a, const IndexedPoint &b);
+    /**
+     * @brief Builds the hull of sorted points with the monotone chain.
+     *
+     * @param points The points, sorted with compareIndexedPoint().
+     * @param n The number of points.
+     * @param lower Room for n positions in the sorted points, used for the lower chain.
+     * @param out Room for n indices, set to the indices of the points on the hull.
+     * @return int The number of points on the hull.
+     */
+    static int chain(const IndexedPoint *points, int n, int *lower, int *out);
+    /**
+     * @brief Computes the hull of a set of at most SMALL_SET_SIZE points.
+     *
+     * @param xs The x co-ordinates of the points of all the sets.
+     * @param ys The y co-ordinates of the points of all the sets.
+     * @param begin The index of the first point of the set.
+     * @param n The number of points of the set.
+     * @param out Room for n indices, set to the indices of the points on the hull.
+     * @return int The number of points on the hull.
+     */
+    static int smallHull(const float *xs, const float *ys, int begin, int n, int *out);
+    /**
+     * @brief Computes the hull of a set of any size.
+     *
+     * @param xs The x co-ordinates of the points of all the sets.
+     * @param ys The y co-ordinates of the points of all the sets.
+     * @param begin The index of the first point of the set.
+     * @param n The number of points of the set.
+     * @param scratch Buffers reused from set to set, grown as needed.
+     * @param out Room for n indices, set to the indices of the points on the hull.
+     * @return int The number of points on the hull.
+     */
+    static int largeHull(const float *xs, const float *ys, int begin, int n, Scratch &scratch, int *out);
+
+    /**
+     * @brief The number of points after which a chunk of sets is closed.
+     *
+     */
+    int grainSize;
+    /**
+     * @brief The hulls of all the sets, one after the other.
+     *
+     */
+    std::vector<int> indices;
+    /**
+     * @brief Where the hull of every set starts in BatchHull::indices.
+     *
+     */
+    std::vector<int> hullOffsets;
+};
+
+#endif // BATCH_HULL_H
\ No newline at end of file
@@ -0,0 +1,287 @@
+/**
+ * @file binary_point_file.h
+ * @brief Contains the declaration of the BinaryPointFile class.
+ *
+ * This class reads and writes the binary point file format, a compact alternative to the "(x, y)" text format that
+ * needs no parsing.
+ *
+ */
+#ifndef BINARY_POINT_FILE_H
+#define BINARY_POINT_FILE_H
+
+#include "mapped_file.h"
+#include "raylib.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Represents the BinaryPointFile class, giving access to the points of a binary point file straight from its
+ * mapping.
+ *
+ * A binary point file is made of, in native little endian byte order:
+ * 1. A header of BinaryPointFile::HEADER_SIZE bytes: the magic "CHPF", the version, the number of points, the type of
+ * the co-ordinates, the bounding box of the points, and the offset and number of points of a precomputed convex hull,
+ * the offset being 0 when there is none.
+ * 2. The x co-ordinates of all the points, followed by their y co-ordinates.
+ * 3. If there is a precomputed hull, the x co-ordinates of its points followed by their y co-ordinates, at the offset
+ * given in the header.
+ *
+ * Since the co-ordinates are stored as structure of arrays in the type of the file, getXs() and getYs() of a file of
+ * FLOAT32 co-ordinates point into the mapping itself, with no copy, and HullPrefilter can read them there so that only
+ * the points it keeps are copied. readPoints() builds the points the engines take in one pass over the two blocks.
+ * PointFileReader recognises the format by its magic, so every reader of the text format reads binary files as well.
+ *
+ * Usage:
+ * 1. Call write() to save points, and optionally their hull, to a binary point file.
+ * 2. Create an instance of the BinaryPointFile class and call open() with the path of a binary point file.
+ * 3. Call getXs() and getYs(), or readPoints(), to get the points.
+ *
+ */
+class BinaryPointFile
+{
+  public:
+    /**
+     * @brief Represents the type of the co-ordinates in a file.
+     *
+     */
+    enum CoordinateType
+    {
+        FLOAT32 = 1,
+        FLOAT64 = 2
+    };
+
+    /**
+     * @brief The size of the header in bytes.
+     *
+     */
+    static const int HEADER_SIZE = 72;
+    /**
+     * @brief The version of the format written by write().
+     *
+     */
+    static const uint32_t VERSION = 1;
+
+    /**
+     * @brief Constructs a new Binary Point File object with no file open.
+     *
+     */
+    BinaryPointFile();
+    /**
+     * @brief Checks whether the contents of a file start with the magic of the format.
+     *
+     * @param data The contents of the file.
+     * @param size The size of the contents in bytes.
+     * @return true If the file is a binary point file.
+     * @return false otherwise.
+     */
+    static bool isBinaryPointFile(const char *data, size_t size);
+    /**
+     * @brief Writes points to a binary point file with FLOAT32 co-ordinates.
+     *
+     * @param filePath The path to the file, which is replaced.
+     * @param points The points.
+     * @param hull The precomputed convex hull of the points, or an empty vector to leave it out.
+     * @param error Set to the reason the file could not be written.
+     * @return true If the file was written.
+     * @return false otherwise.
+     */
+    static bool write(const std::string &filePath, const std::vector<Vector2> &points, const std::vector<Vector2> &hull,
+                      std::string &error);
+
+    /**
+     * @brief Opens a binary point file, checking that its header agrees with its size.
+     *
+     * @param filePath The path to the file.
+     * @return true If the file is a valid binary point file.
+     * @return false otherwise, in which case getError() tells why.
+     */
+    bool open(const std::string &filePath);
+    /**
+     * @brief Opens a binary point file that is already mapped, such as the standard input, which cannot be read twice.
+     *
+     * @param filePath The path to the file, used in the errors.
+     * @param contents The mapped file, whose contents are taken over and which is left closed.
+     * @return true If the file is a valid binary point file.
+     * @return false otherwise, in which case getError() tells why.
+     */
+    bool open(const std::string &filePath, MappedFile &contents);
+    /**
+     * @brief Unmaps the file.
+     *
+     */
+    void close();
+    /**
+     * @brief Gets the size of the file.
+     *
+     * @return size_t The size of the file in bytes.
+     */
+    size_t getSize() const;
+    /**
+     * @brief Gets the number of points.
+     *
+     * @return long long The number of points.
+     */
+    long long getCount() const;
+    /**
+     * @brief Gets the type of the co-ordinates.
+     *
+     * @return CoordinateType The type of the co-ordinates.
+     */
+    CoordinateType getCoordinateType() const;
+    /**
+     * @brief Gets the corner of the bounding box with the smallest co-ordinates.
+     *
+     * @return Vector2 The smallest x and y co-ordinates.
+     */
+    Vector2 getMin() const;
+    /**
+     * @brief Gets the corner of the bounding box with the largest co-ordinates.
+     *
+     * @return Vector2 The largest x and y co-ordinates.
+     */
+    Vector2 getMax() const;
+    /**
+     * @brief Gets the x co-ordinates in place.
+     *
+     * @return const float* The x co-ordinates of all the points, nullptr unless the co-ordinates are FLOAT32.
+     */
+    const float *getXs() const;
+    /**
+     * @brief Gets the y co-ordinates in place.
+     *
+     * @return const float* The y co-ordinates of all the points, nullptr unless the co-ordinates are FLOAT32.
+     */
+    const float *getYs() const;
+    /**
+     * @brief Copies a range of points, in any co-ordinate type.
+     *
+     * @param first The index of the first point.
+     * @param count The number of points.
+     * @param out Room for count points, set to the points.
+     */
+    void readPoints(long long first, int count, Vector2 *out) const;
+    /**
+     * @brief Checks whether the file holds a precomputed convex hull.
+     *
+     * @return true If it does.
+     * @return false otherwise.
+     */
+    bool hasHull() const;
+    /**
+     * @brief Gets the precomputed convex hull.
+     *
+     * @return std::vector<Vector2> The points on the hull, empty if there is none.
+     */
+    std::vector<Vector2> getHull() const;
+    /**
+     * @brief Gets why the last call to open() failed.
+     *
+     * @return const std::string& The path and the reason, empty if nothing went wrong.
+     */
+    const std::string &getError() const;
+
+  private:
+    /**
+     * @brief Represents the header at the start of the file.
+     *
+     */
+    struct Header
+    {
+        /**
+         * @brief The magic "CHPF".
+         *
+         */
+        char magic[4];
+        /**
+         * @brief The version of the format.
+         *
+         */
+        uint32_t version;
+        /**
+         * @brief The number of points.
+         *
+         */
+        uint64_t count;
+        /**
+         * @brief The type of the co-ordinates, one of CoordinateType.
+         *
+         */
+        uint32_t coordinateType;
+        /**
+         * @brief Unused, 0.
+         *
+         */
+        uint32_t reserved;
+        /**
+         * @brief The bounding box of the points: smallest x, smallest y, largest x and largest y.
+         *
+         */
+        double bounds[4];
+        /**
+         * @brief The offset in bytes of the precomputed hull, 0 if there is none.
+         *
+         */
+        uint64_t hullOffset;
+        /**
+         * @brief The number of points on the precomputed hull.
+         *
+         */
+        uint64_t hullCount;
+    };
+    static_assert(sizeof(Header) == HEADER_SIZE, "the header must match the format");
+
+    /**
+     * @brief The magic at the start of every binary point file.
+     *
+     */
+    static const char MAGIC[4];
+
+    /**
+     * @brief Reads the header of the mapped file, checking that it agrees with the size of the file.
+     *
+     * @return true If the file is a valid binary point file.
+     * @return false otherwise.
+     */
+    bool readHeader();
+    /**
+     * @brief Copies points from a pair of co-ordinate blocks.
+     *
+     * @param offset The offset in bytes of the x block in the file.
+     * @param blockCount The number of co-ordinates in each block.
+     * @param first The index of the first point.
+     * @param count The number of points.
+     * @param out Room for count points, set to the points.
+     */
+    void copyPoints(uint64_t offset, uint64_t blockCount, long long first, int count, Vector2 *out) const;
+    /**
+     * @brief Sets the error for an invalid file and closes it.
+     *
+     * @param reason What is wrong with the file.
+     * @return false always.
+     */
+    bool fail(const char *reason);
+
+    /**
+     * @brief The mapped file.
+     *
+     */
+    MappedFile file;
+    /**
+     * @brief The header of the file.
+     *
+     */
+    Header header = {};
+    /**
+     * @brief The path of the open file.
+     *
+     */
+    std::string path;
+    /**
+     * @brief Why the last call to open() failed, empty if it did not.
+     *
+     */
+    std::string error;
+};
+
+#endif // BINARY_POINT_FILE_H
\ No newline at end of file
@@ -0,0 +1,126 @@
+/**
+ * @file chan.h
+ * @brief Contains the declaration of the Chan class.
+ *
+ * This class implements Chan's algorithm to compute the convex hull of a set of points.
+ *
+ */
+#ifndef CHAN_H
+#define CHAN_H
+
+#include "chan_engine.h"
+#include "convex_hull.h"
+
+/**
+ * @brief Represents the Chan class, implementing Chan's algorithm for computing the convex hull of a set of points.
+ *
+ * The computation itself is done by ChanEngine, with every step recorded, while this class draws the recorded steps:
+ * the mini hulls of every guess, and the tangents from the last point of the hull to each of them.
+ *
+ * Usage:
+ * 1. Create an instance of the Chan class with the points to be used to compute the convex hull. The convex hull is
+ * computed in the constructor.
+ * 2. Call the next() or previous() method to get the next or previous step in the convex hull computation process.
+ * 3. Call the draw() method to draw the current step of the convex hull computation process.
+ *
+ */
+class Chan : public ConvexHullAlgorithm, private ChanEngine<Record>
+{
+  public:
+    /**
+     * @brief Constructs a new Chan object.
+     *
+     * @param p Set of input points.
+     */
+    Chan(std::vector<Vector2> p);
+    /**
+     * @brief Destroys the Chan object.
+     *
+     */
+    ~Chan();
+
+    /**
+     * @brief Draws the Chan::currentStep of the Chan object.
+     *
+     */
+    void draw();
+    /**
+     * @brief Gets the next step of the Chan object.
+     *
+     */
+    void next();
+    /**
+     * @brief Gets the previous step of the Chan object.
+     *
+     */
+    void previous();
+    /**
+     * @brief Checks if the Chan object has reached the last step in Chan::steps.
+     *
+     * @return true If the Chan object has reached the last step.
+     * @return false If the Chan object has not reached the last step.
+     */
+    bool isFinished();
+    /**
+     * @brief Gets the Number Of Steps in the convex hull computation.
+     *
+     * @return int number of steps.
+     */
+    int getNumberOfSteps();
+    /**
+     * @brief Gets the Current Step that is being drawn.
+     *
+     * @return int The current step.
+     */
+    int getCurrentStep();
+    /**
+     * @brief Sets the current step to the specified value.
+     *
+     * @param step The value to set the current step to.
+     */
+    void setCurrentStep(int step);
+    /**
+     * @brief Shows the legend for the visualization of the Chan computation.
+     *
+     * @param showLegend The variable used to indicate if the legend is to be displayed.
+     * @param windowPosition The position of the legend window on the screen.
+     * @param windowSize The size of the legend window.
+     * @param maxWindowSize The size of the legend window in the maximized state.
+     * @param contentSize The size of the content window inside the legend window.
+     * @param scroll The object used to keep track of current position after scrolling.
+     * @param moving The variable used to indicate if the floating window is moving.
+     * @param resizing The variable used to indicate if the floating window is resizing.
+     * @param minimized The variable used to indicate if the floating window is minimized.
+     * @param toolbarHeight The height of the toolbar.
+     * @param bottomBarHeight The height of the bottomBar.
+     * @param title The title for the floating window.
+     */
+    void showLegend(bool *showLegend, Vector2 *windowPosition, Vector2 *windowSize, Vector2 *maxWindowSize,
+                    Vector2 *contentSize, Vector2 *scroll, bool *moving, bool *resizing, bool *minimized,
+                    float toolbarHeight, float bottomBarHeight, const char *title);
+    /**
+     * @brief Gets all the points on the final convex hull.
+     *
+     * @return std::vector<Vector2> All the points on the convex hull.
+     */
+    std::vector<Vector2> exportHull();
+
+  private:
+    /**
+     * @brief Draws a closed polygon.
+     *
+     * @param polygon The first point of the polygon.
+     * @param count The number of points of the polygon.
+     * @param lineColor The color of the edges.
+     * @param pointColor The color of the points.
+     */
+    void drawPolygon(const Vector2 *polygon, int count, Color lineColor, Color pointColor);
+
+    /**
+     * @brief The current step in the visualization process.
+     *
+     */
+    int currentStep = 0;
+};
+
+#endif // CHAN_H
\ No newline at end of file
@@ -0,0 +1,294 @@
+/**
+ * @file chan_engine.h
+ * @brief Contains the declaration of the ChanEngine class template.
+ *
+ * This class implements the computation of Chan's algorithm without any drawing, so that it can be used both by the
+ * visualizer and by headless programs.
+ *
+ */
+#ifndef CHAN_ENGINE_H
+#define CHAN_ENGINE_H
+
+#include "raylib.h"
+#include "step_recording.h"
+#include "task_scheduler.h"
+#include <vector>
+
+/**
+ * @brief Represents the ChanEngine class, implementing Chan's algorithm for computing the convex hull of a set of
+ * points.
+ *
+ * For a guess m of the number of points on the hull, the points are split into groups of m points and the hull of
+ * every group, its mini hull, is computed with a monotone chain. The hull is then wrapped like in the Jarvis March,
+ * except that the next point is only looked for among the tangents from the current point to the mini hulls, each
+ * one found by a binary search. If the hull does not close within m points the guess is squared, so the algorithm is
+ * O(n log h).
+ *
+ * The mini hulls are computed in parallel on the TaskScheduler. Points that lie on an edge of the hull are not part of
+ * it, and duplicate points are only taken once.
+ *
+ * Usage:
+ * 1. Create an instance of the ChanEngine class with the points to be used to compute the convex hull. The convex hull
+ * is computed in the constructor.
+ * 2. Call the getConvexHull() method to get the points on the convex hull.
+ *
+ * @tparam Recording The step recording policy, Record to record the steps for the visualizer or NoRecord to skip them.
+ */
+template <typename Recording> class ChanEngine
+{
+  public:
+    /**
+     * @brief Represents the kind of a step in the algorithm.
+     *
+     */
+    enum StepType
+    {
+        GROUP_HULLS,
+        TANGENT,
+        WRAP,
+        GUESS_FAILED,
+        FINISH
+    };
+
+    /**
+     * @brief Guesses with fewer points than this in total compute their mini hulls serially by default.
+     *
+     */
+    static const int DEFAULT_GRAIN_SIZE = 1 << 14;
+
+    /**
+     * @brief Constructs a new Chan Engine object and computes the convex hull.
+     *
+     * @param p Set of input points.
+     * @param grainSize The number of points whose mini hulls are computed by one task of the shared TaskScheduler.
+     */
+    ChanEngine(std::vector<Vector2> p, int grainSize = DEFAULT_GRAIN_SIZE);
+    /**
+     * @brief Gets all the points on the final convex hull.
+     *
+     * @return const std::vector<Vector2>& All the points on the convex hull, in clockwise order with y pointing up from
+     * the point with the smallest x and y co-ordinates.
+     */
+    const std::vector<Vector2> &getConvexHull() const;
+    /**
+     * @brief Gets the size of the groups of the guess that succeeded.
+     *
+     * @return int The size of the groups.
+     */
+    int getGroupSize() const;
+    /**
+     * @brief Gets the number of points of the mini hulls looked at while finding the tangents, over all the guesses.
+     *
+     * @return long long The number of points looked at, O(log m) for every tangent from a point outside of a mini
+     * hull and one for every tangent from a point on it.
+     */
+    long long getTangentProbes() const;
+    /**
+     * @brief Comparator function for Vector2. A vector is defined as smaller than another if it has a smaller X
+     * coordinate. For equal X coordinates, the one with the smaller Y coordinate is considered smaller.
+     *
+     * @param a The first Vector2 operand.
+     * @param b The second Vector2 operand.
+     * @return true if (a < b).
+     * @return false otherwise.
+     */
+    static bool compareVector2(Vector2 a, Vector2 b);
+
+  protected:
+    /**
+     * @brief Holds the mini hulls and the wrapped points of one guess, for the visualizer.
+     *
+     */
+    struct ChanGuess
+    {
+        /**
+         * @brief The size of the groups.
+         *
+         */
+        int groupSize;
+        /**
+         * @brief The index in ChanGuess::groupHulls of the first point of every mini hull.
+         *
+         */
+        std::vector<int> hullBegin;
+        /**
+         * @brief The number of points of every mini hull.
+         *
+         */
+        std::vector<int> hullSize;
+        /**
+         * @brief The points of all the mini hulls, one after the other.
+         *
+         */
+        std::vector<Vector2> groupHulls;
+        /**
+         * @brief The points wrapped so far, the partial hull of a step being a prefix of them.
+         *
+         */
+        std::vector<Vector2> wrap;
+    };
+    /**
+     * @brief Represents information about a step in Chan's algorithm.
+     *
+     */
+    struct ChanStep
+    {
+        /**
+         * @brief The kind of the step.
+         *
+         */
+        StepType type;
+        /**
+         * @brief The index in ChanEngine::guesses of the guess the step belongs to.
+         *
+         */
+        int guess;
+        /**
+         * @brief The index of the mini hull whose tangent is found, -1 if there is none.
+         *
+         */
+        int group;
+        /**
+         * @brief The number of points of ChanGuess::wrap found so far.
+         *
+         */
+        int wrapLength;
+        /**
+         * @brief The point the tangents are drawn from.
+         *
+         */
+        Vector2 current;
+        /**
+         * @brief The tangent point found on the mini hull.
+         *
+         */
+        Vector2 tangent;
+        /**
+         * @brief The best of the tangent points found so far, the next point of the hull once all are found.
+         *
+         */
+        Vector2 best;
+    };
+
+    /**
+     * @brief Computes the cross product of the vectors from o to a and from o to b, positive when o, a and b turn
+     * counter-clockwise with y pointing up.
+     *
+     * @param o The common origin.
+     * @param a The end of the first vector.
+     * @param b The end of the second vector.
+     * @return float The cross product.
+     */
+    static float cross(Vector2 o, Vector2 a, Vector2 b);
+    /**
+     * @brief Tells whether a point wrapping clockwise from p should be taken over another, that is if it is left of
+     * the line from p to the other point, or on it but further away.
+     *
+     * @param p The point being wrapped from.
+     * @param best The point taken so far.
+     * @param candidate The point to compare.
+     * @return true If the candidate should be taken.
+     * @return false otherwise.
+     */
+    static bool isBetter(Vector2 p, Vector2 best, Vector2 candidate);
+    /**
+     * @brief Sorts a group of points and computes its hull with a monotone chain.
+     *
+     * @param S The points of the group, sorted in place.
+     * @param n The number of points of the group.
+     * @param out Room for n points, to which the hull is written in clockwise order.
+     * @param scratch Room for n points, used for the lower chain.
+     * @return int The number of points on the hull.
+     */
+    static int miniHull(Vector2 *S, int n, Vector2 *out, Vector2 *scratch);
+    /**
+     * @brief Computes the mini hulls of all the groups of the given size, in parallel.
+     *
+     * @param m The size of the groups.
+     */
+    void computeMiniHulls(int m);
+    /**
+     * @brief Finds the tangent from a point to a mini hull.
+     *
+     * If the point is on the mini hull the tangent is the point after it, otherwise it is found with a binary search
+     * over the mini hull.
+     *
+     * @param group The index of the mini hull.
+     * @param p The point, on the convex hull of all the points.
+     * @param current The index of p on the mini hull, or -1 if p is not a point of it.
+     * @return int The index in ChanEngine::groupHulls of the point of the mini hull that every other point of it is
+     * right of or on the line to, or -1 if all the points of the mini hull are equal to p.
+     */
+    int tangent(int group, Vector2 p, int current);
+    /**
+     * @brief Wraps the hull from its first point, visiting at most m points.
+     *
+     * @param m The size of the groups, and the most points that the hull may have.
+     * @return true If the hull closed within m points.
+     * @return false otherwise.
+     */
+    bool wrap(int m);
+    /**
+     * @brief Computes the convex hull, recording all the steps in the process if the policy asks for it.
+     *
+     */
+    void computeConvexHull();
+
+    /**
+     * @brief The collection of points to be used to compute the convex hull.
+     *
+     */
+    std::vector<Vector2> points;
+    /**
+     * @brief The calculated convex hull.
+     *
+     */
+    std::vector<Vector2> hull;
+    /**
+     * @brief The points split into groups, every group sorted in place by ChanEngine::miniHull().
+     *
+     */
+    std::vector<Vector2> work;
+    /**
+     * @brief The mini hulls, every one at the start of the range of its group.
+     *
+     */
+    std::vector<Vector2> groupHulls;
+    /**
+     * @brief Scratch array for the lower chains of the mini hulls, as large as ChanEngine::work.
+     *
+     */
+    std::vector<Vector2> chainScratch;
+    /**
+     * @brief The number of points of every mini hull.
+     *
+     */
+    std::vector<int> hullSizes;
+    /**
+     * @brief The size of the groups of the current guess.
+     *
+     */
+    int groupSize = 0;
+    /**
+     * @brief The guesses made, only filled when recording.
+     *
+     */
+    std::vector<ChanGuess> guesses;
+    /**
+     * @brief Holds the steps in the computation of the convex hull, only filled when recording.
+     *
+     */
+    std::vector<ChanStep> steps;
+    /**
+     * @brief The number of points whose mini hulls are computed by one task.
+     *
+     */
+    int grainSize;
+    /**
+     * @brief The number of points of the mini hulls looked at while finding the tangents.
+     *
+     */
+    long long tangentProbes = 0;
+};
+
+#endif // CHAN_ENGINE_H
\ No newline at end of file
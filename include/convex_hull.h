@@ -18,26 +18,12 @@
 /**
  * @brief Abstract class that represents a convex hull algorithm.
  *
- * This class contains the common methods and attributes that all convex hull algorithms should have.
+ * This class contains the common methods and attributes that all convex hull algorithms should have. The points and
+ * the computed hull are owned by the engine each algorithm draws from.
  */
 class ConvexHullAlgorithm
 {
   private:
-    /**
-     * @brief The collection of points to be used to compute the convex hull.
-     *
-     */
-    std::vector<Vector2> points;
-    /**
-     * @brief Represents the convex hull.
-     *
-     */
-    std::vector<Vector2> convexHull;
-    /**
-     * @brief Computes all the steps in the convex hull computation process.
-     *
-     */
-    virtual void computeConvexHull() = 0;
     /**
      * @brief Represents the current step in the ConvexHullAlgorithm object.
      *
@@ -0,0 +1,130 @@
+/**
+ * @file convex_layers.h
+ * @brief Contains the declaration of the ConvexLayers class.
+ *
+ * This class peels a set of points into its convex layers, stepping through them one at a time.
+ *
+ */
+#ifndef CONVEX_LAYERS_H
+#define CONVEX_LAYERS_H
+
+#include "convex_hull.h"
+#include "convex_layers_engine.h"
+
+/**
+ * @brief Represents the ConvexLayers class, peeling a set of points into its convex layers.
+ *
+ * The computation itself is done by ConvexLayersEngine, with every step recorded, while this class draws the recorded
+ * steps: every step adds the next layer, drawn over the layers already peeled.
+ *
+ * Usage:
+ * 1. Create an instance of the ConvexLayers class with the points to be peeled. The layers are computed in the
+ * constructor.
+ * 2. Call the next() or previous() method to get the next or previous step in the computation process.
+ * 3. Call the draw() method to draw the current step of the computation process.
+ *
+ */
+class ConvexLayers : public ConvexHullAlgorithm, private ConvexLayersEngine<Record>
+{
+  public:
+    /**
+     * @brief Constructs a new ConvexLayers object.
+     *
+     * @param p Set of input points.
+     */
+    ConvexLayers(std::vector<Vector2> p);
+    /**
+     * @brief Destroys the ConvexLayers object.
+     *
+     */
+    ~ConvexLayers();
+
+    /**
+     * @brief Draws the ConvexLayers::currentStep of the ConvexLayers object.
+     *
+     */
+    void draw();
+    /**
+     * @brief Gets the next step of the ConvexLayers object.
+     *
+     */
+    void next();
+    /**
+     * @brief Gets the previous step of the ConvexLayers object.
+     *
+     */
+    void previous();
+    /**
+     * @brief Checks if the ConvexLayers object has reached the last step in ConvexLayers::steps.
+     *
+     * @return true If the ConvexLayers object has reached the last step.
+     * @return false If the ConvexLayers object has not reached the last step.
+     */
+    bool isFinished();
+    /**
+     * @brief Gets the Number Of Steps in the convex layers computation.
+     *
+     * @return int number of steps.
+     */
+    int getNumberOfSteps();
+    /**
+     * @brief Gets the Current Step that is being drawn.
+     *
+     * @return int The current step.
+     */
+    int getCurrentStep();
+    /**
+     * @brief Sets the current step to the specified value.
+     *
+     * @param step The value to set the current step to.
+     */
+    void setCurrentStep(int step);
+    /**
+     * @brief Shows the legend for the visualization of the ConvexLayers computation.
+     *
+     * @param showLegend The variable used to indicate if the legend is to be displayed.
+     * @param windowPosition The position of the legend window on the screen.
+     * @param windowSize The size of the legend window.
+     * @param maxWindowSize The size of the legend window in the maximized state.
+     * @param contentSize The size of the content window inside the legend window.
+     * @param scroll The object used to keep track of current position after scrolling.
+     * @param moving The variable used to indicate if the floating window is moving.
+     * @param resizing The variable used to indicate if the floating window is resizing.
+     * @param minimized The variable used to indicate if the floating window is minimized.
+     * @param toolbarHeight The height of the toolbar.
+     * @param bottomBarHeight The height of the bottomBar.
+     * @param title The title for the floating window.
+     */
+    void showLegend(bool *showLegend, Vector2 *windowPosition, Vector2 *windowSize, Vector2 *maxWindowSize,
+                    Vector2 *contentSize, Vector2 *scroll, bool *moving, bool *resizing, bool *minimized,
+                    float toolbarHeight, float bottomBarHeight, const char *title);
+    /**
+     * @brief Gets all the points on the final convex hull.
+     *
+     * @return std::vector<Vector2> All the points on the outermost layer.
+     */
+    std::vector<Vector2> exportHull();
+
+  private:
+    /**
+     * @brief Draws a layer as a closed polygon.
+     *
+     * @param layer The index of the layer.
+     * @param lineColor The color of the edges.
+     * @param lineThickness The thickness of the edges.
+     */
+    void drawLayer(int layer, Color lineColor, float lineThickness);
+
+    /**
+     * @brief The colors the peeled layers cycle through, from the outermost one inwards.
+     *
+     */
+    static const Color LAYER_COLORS[4];
+    /**
+     * @brief The current step in the visualization process.
+     *
+     */
+    int currentStep = 0;
+};
+
+#endif // CONVEX_LAYERS_H
\ No newline at end of file
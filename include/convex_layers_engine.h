@@ -0,0 +1,286 @@
+/**
+ * @file convex_layers_engine.h
+ * @brief Contains the declaration of the ConvexLayersEngine class template.
+ *
+ * This class implements the computation of the convex layers of a set of points without any drawing, so that it can
+ * be used both by the visualizer and by headless programs.
+ *
+ */
+#ifndef CONVEX_LAYERS_ENGINE_H
+#define CONVEX_LAYERS_ENGINE_H
+
+#include "raylib.h"
+#include "step_recording.h"
+#include "task_scheduler.h"
+#include <vector>
+
+/**
+ * @brief Represents the ConvexLayersEngine class, peeling a set of points into its convex layers: the first layer is
+ * the boundary of the convex hull of the points, the second one the boundary of the convex hull of the points left
+ * once the first layer is removed, and so on until no point is left.
+ *
+ * The points are sorted once, by x co-ordinate. Every layer is then found by one pass of the monotone chain over the
+ * active points, still in sorted order, and the points of the layer are removed by compacting them in place, so no
+ * layer sorts the points again.
+ *
+ * The active points are the points left that are not strictly inside an anchor polygon, whose corners are points left
+ * that lie deep inside: a sample of the points left is itself peeled, and the polygon is the layer of the sample that
+ * leaves about the chosen part of the sample outside. As long as all the corners are left, every point strictly inside
+ * the polygon is strictly inside the hull of the points left, so it cannot be on a layer and the layer of the active
+ * points is the layer of all the points. Once a layer takes a corner, a new polygon is chosen from the points left.
+ * Since the corners are all on one layer of the sample, they are about as deep as each other and are reached at about
+ * the same time. A layer thus takes time linear in the number of active points rather than in the number of points
+ * left, and a pass over all the points left is only made every time the polygon is chosen again.
+ *
+ * The upper and the lower chain of a large layer are built in parallel on the TaskScheduler.
+ *
+ * The points lying on an edge of a layer are part of it, and all the copies of a point are in the same layer, which
+ * holds the point once.
+ *
+ * Usage:
+ * 1. Create an instance of the ConvexLayersEngine class with the points to be peeled. The layers are computed in the
+ * constructor.
+ * 2. Call getLayerCount() and getLayer() to get the layers, or getDepths() to get the layer of every point.
+ *
+ * @tparam Recording The step recording policy, Record to record the steps for the visualizer or NoRecord to skip them.
+ */
+template <typename Recording> class ConvexLayersEngine
+{
+  public:
+    /**
+     * @brief Represents the kind of a step in the algorithm.
+     *
+     */
+    enum StepType
+    {
+        SORT,
+        LAYER,
+        FINISH
+    };
+
+    /**
+     * @brief Layers of fewer points than this build their two chains serially by default.
+     *
+     */
+    static const int DEFAULT_GRAIN_SIZE = 1 << 15;
+    /**
+     * @brief The fewest active points aimed for when an anchor polygon is chosen.
+     *
+     */
+    static const int MIN_ACTIVE_COUNT = 4096;
+    /**
+     * @brief The number of points sampled to choose the corners of an anchor polygon.
+     *
+     */
+    static const int SAMPLE_SIZE = 4096;
+
+    /**
+     * @brief Constructs a new Convex Layers Engine object and computes the convex layers.
+     *
+     * @param p Set of input points.
+     * @param grainSize Layers computed from fewer points than this build their upper and lower chains serially instead
+     * of in parallel on the shared TaskScheduler.
+     */
+    ConvexLayersEngine(std::vector<Vector2> p, int grainSize = DEFAULT_GRAIN_SIZE);
+    /**
+     * @brief Gets the number of layers.
+     *
+     * @return int The number of layers.
+     */
+    int getLayerCount() const;
+    /**
+     * @brief Gets the points of a layer.
+     *
+     * @param layer The index of the layer, 0 for the boundary of the convex hull.
+     * @return std::vector<Vector2> All the points on the layer, in clockwise order with y pointing up from the point
+     * with the smallest x and y co-ordinates.
+     */
+    std::vector<Vector2> getLayer(int layer) const;
+    /**
+     * @brief Gets the layer of every point.
+     *
+     * @return const std::vector<int>& The index of the layer of every input point, in input order.
+     */
+    const std::vector<int> &getDepths() const;
+    /**
+     * @brief Comparator function for Vector2. A vector is defined as smaller than another if it has a smaller X
+     * coordinate. For equal X coordinates, the one with the smaller Y coordinate is considered smaller.
+     *
+     * @param a The first Vector2 operand.
+     * @param b The second Vector2 operand.
+     * @return true if (a < b).
+     * @return false otherwise.
+     */
+    static bool compareVector2(Vector2 a, Vector2 b);
+
+  protected:
+    /**
+     * @brief Represents information about a step in the algorithm.
+     *
+     */
+    struct ConvexLayersStep
+    {
+        /**
+         * @brief The kind of the step.
+         *
+         */
+        StepType type;
+        /**
+         * @brief The index of the layer that was peeled, -1 if there is none.
+         *
+         */
+        int layer;
+    };
+
+    /**
+     * @brief Computes the cross product of the vectors from o to a and from o to b, positive when o, a and b turn
+     * counter-clockwise with y pointing up.
+     *
+     * @param o The common origin.
+     * @param a The end of the first vector.
+     * @param b The end of the second vector.
+     * @return float The cross product.
+     */
+    static float cross(Vector2 o, Vector2 a, Vector2 b);
+    /**
+     * @brief Builds a chain of the hull of the active points, keeping the points lying on its edges.
+     *
+     * @tparam Upper Whether to build the upper chain, which turns clockwise, or the lower one.
+     * @param chain Room for all the active points, set to the positions in ConvexLayersEngine::active of the points on
+     * the chain, from left to right.
+     * @return int The number of points on the chain.
+     */
+    template <bool Upper> int buildChain(int *chain) const;
+    /**
+     * @brief Tells whether a point is strictly to the left of the line through a and b, by a margin covering the
+     * rounding error of the test.
+     *
+     * @param a The start of the line.
+     * @param b The end of the line.
+     * @param p The point.
+     * @return true If the point is strictly to the left.
+     * @return false otherwise.
+     */
+    static bool isLeftOf(Vector2 a, Vector2 b, Vector2 p);
+    /**
+     * @brief Chooses the anchor polygon from a sample of ConvexLayersEngine::sorted.
+     *
+     * @param aim The number of active points aimed for. With no more than twice as many points left, no polygon is
+     * chosen.
+     */
+    void chooseAnchors(int aim);
+    /**
+     * @brief Removes the points already on a layer from ConvexLayersEngine::sorted, chooses a new anchor polygon and
+     * gathers the active points.
+     *
+     */
+    void selectActive();
+    /**
+     * @brief Finds the next layer from the active points and removes its points from them.
+     *
+     * @return int The number of points on the layer, counting every copy of a point.
+     */
+    int peelLayer();
+    /**
+     * @brief Computes the convex layers, recording all the steps in the process if the policy asks for it.
+     *
+     */
+    void computeConvexLayers();
+
+    /**
+     * @brief The collection of points to be peeled.
+     *
+     */
+    std::vector<Vector2> points;
+    /**
+     * @brief The points left when the active points were last gathered, sorted with
+     * ConvexLayersEngine::compareVector2.
+     *
+     */
+    std::vector<Vector2> sorted;
+    /**
+     * @brief The index in ConvexLayersEngine::points of every point of ConvexLayersEngine::sorted.
+     *
+     */
+    std::vector<int> sortedIndices;
+    /**
+     * @brief The active points, in sorted order.
+     *
+     */
+    std::vector<Vector2> active;
+    /**
+     * @brief The index in ConvexLayersEngine::points of every point of ConvexLayersEngine::active.
+     *
+     */
+    std::vector<int> activeIndices;
+    /**
+     * @brief The corners on the lower chain of the anchor polygon from left to right, empty when all the points left
+     * are active.
+     *
+     */
+    std::vector<Vector2> anchorLower;
+    /**
+     * @brief The corners on the upper chain of the anchor polygon from left to right, empty when all the points left
+     * are active.
+     *
+     */
+    std::vector<Vector2> anchorUpper;
+    /**
+     * @brief The index in ConvexLayersEngine::points of every corner of the anchor polygon.
+     *
+     */
+    std::vector<int> anchorIndices;
+    /**
+     * @brief Scales the part of the sample left outside the anchor polygon, tuned every time a polygon is chosen so
+     * that the number of active points comes close to the aim.
+     *
+     */
+    double anchorScale = 0.25;
+    /**
+     * @brief The upper chain of the layer being peeled.
+     *
+     */
+    std::vector<int> upper;
+    /**
+     * @brief The lower chain of the layer being peeled.
+     *
+     */
+    std::vector<int> lower;
+    /**
+     * @brief Marks the active points on the layer being peeled.
+     *
+     */
+    std::vector<char> onLayer;
+    /**
+     * @brief The points of all the layers, one layer after the other.
+     *
+     */
+    std::vector<Vector2> layerPoints;
+    /**
+     * @brief Where every layer starts in ConvexLayersEngine::layerPoints, followed by the number of points there.
+     *
+     */
+    std::vector<int> layerOffsets;
+    /**
+     * @brief The layer of every input point, -1 for the points left.
+     *
+     */
+    std::vector<int> depths;
+    /**
+     * @brief Holds the steps in the computation of the layers, only filled when recording.
+     *
+     */
+    std::vector<ConvexLayersStep> steps;
+    /**
+     * @brief Layers of fewer points than this build their chains serially.
+     *
+     */
+    int grainSize;
+    /**
+     * @brief The scheduler that builds the chains of large layers in parallel.
+     *
+     */
+    TaskScheduler *scheduler = nullptr;
+};
+
+#endif // CONVEX_LAYERS_ENGINE_H
\ No newline at end of file
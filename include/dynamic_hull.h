@@ -0,0 +1,300 @@
+/**
+ * @file dynamic_hull.h
+ * @brief Contains the declaration of the DynamicHull class.
+ *
+ * This class keeps the convex hull of a set of points up to date as any of the points are added or removed.
+ *
+ */
+#ifndef DYNAMIC_HULL_H
+#define DYNAMIC_HULL_H
+
+#include "raylib.h"
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Represents the DynamicHull class, holding the convex hull of a set of points to which points are added and
+ * from which any point is removed one at a time, in the manner of Overmars and van Leeuwen.
+ *
+ * The points are the leaves of a balanced search tree ordered by x co-ordinate, and every inner node keeps the bridges
+ * of its two subtrees, the edges joining the upper hulls and the lower hulls of their points. The hull of a subtree is
+ * thus never stored: it is the hull of its left subtree up to the bridge followed by the hull of its right subtree from
+ * there on, and is walked down through the bridges of the nodes below. The tangent from a point to the hull of a
+ * subtree is found that way in O(log n), and the bridge of a node by a search over the hull of its right subtree that
+ * finds a tangent at every step, in O(log^2 n). Adding or removing a point changes the nodes on one path of the tree,
+ * so it takes O(log^3 n).
+ *
+ * Like MonotoneChainEngine, points that lie on an edge of the hull are not part of it, and duplicate points are only
+ * taken once, though every copy has to be removed for the point to be gone.
+ *
+ * Usage:
+ * 1. Create an instance of the DynamicHull class, empty or with the points already there.
+ * 2. Call insert() and erase() as points come and go.
+ * 3. Call getConvexHull() to get the points on the convex hull.
+ *
+ */
+class DynamicHull
+{
+  public:
+    /**
+     * @brief Constructs a new Dynamic Hull object with no points.
+     *
+     */
+    DynamicHull();
+    /**
+     * @brief Constructs a new Dynamic Hull object with the given points, building the tree in one go.
+     *
+     * @param points Set of input points.
+     */
+    DynamicHull(std::vector<Vector2> points);
+    /**
+     * @brief Adds a point.
+     *
+     * @param p The point.
+     */
+    void insert(Vector2 p);
+    /**
+     * @brief Removes one copy of a point.
+     *
+     * @param p The point.
+     * @return true If the point was there.
+     * @return false otherwise.
+     */
+    bool erase(Vector2 p);
+    /**
+     * @brief Removes all the points.
+     *
+     */
+    void clear();
+    /**
+     * @brief Gets the number of points, counting every copy of a point.
+     *
+     * @return int The number of points.
+     */
+    int size() const;
+    /**
+     * @brief Gets all the points on the convex hull.
+     *
+     * @return std::vector<Vector2> All the points on the convex hull, in clockwise order with y pointing up from the
+     * point with the smallest x and y co-ordinates, the same order as MonotoneChainEngine.
+     */
+    std::vector<Vector2> getConvexHull() const;
+    /**
+     * @brief Comparator function for Vector2. A vector is defined as smaller than another if it has a smaller X
+     * coordinate. For equal X coordinates, the one with the smaller Y coordinate is considered smaller.
+     *
+     * @param a The first Vector2 operand.
+     * @param b The second Vector2 operand.
+     * @return true if (a < b).
+     * @return false otherwise.
+     */
+    static bool compareVector2(Vector2 a, Vector2 b);
+
+  private:
+    /**
+     * @brief Represents the half of the hull being worked on. The lower hull is handled as the upper hull of the
+     * points with their y co-ordinates negated.
+     *
+     */
+    enum Side
+    {
+        UPPER,
+        LOWER
+    };
+
+    /**
+     * @brief Represents a node of the tree, either a leaf holding a point or an inner node with two children.
+     *
+     */
+    struct Node
+    {
+        /**
+         * @brief The point of a leaf, or the largest point of the subtree of an inner node.
+         *
+         */
+        Vector2 point;
+        /**
+         * @brief The number of copies of the point of a leaf.
+         *
+         */
+        int count;
+        /**
+         * @brief The index of the left child in DynamicHull::nodes, -1 for a leaf.
+         *
+         */
+        int left;
+        /**
+         * @brief The index of the right child in DynamicHull::nodes, -1 for a leaf.
+         *
+         */
+        int right;
+        /**
+         * @brief The height of the subtree, 0 for a leaf.
+         *
+         */
+        int height;
+        /**
+         * @brief The bridges of the upper and lower hulls of the children, each one a point of the left subtree and a
+         * point of the right subtree.
+         *
+         */
+        std::pair<Vector2, Vector2> bridges[2];
+    };
+
+    /**
+     * @brief Computes the cross product of the vectors from o to a and from o to b, positive when o, a and b turn
+     * counter-clockwise with y pointing up.
+     *
+     * @param o The common origin.
+     * @param a The end of the first vector.
+     * @param b The end of the second vector.
+     * @return float The cross product.
+     */
+    static float cross(Vector2 o, Vector2 a, Vector2 b);
+    /**
+     * @brief Maps a point to the co-ordinates in which the given half of the hull is an upper hull.
+     *
+     * @tparam S The half of the hull.
+     * @param v The point.
+     * @return Vector2 The mapped point, which is mapped back by mapping it again.
+     */
+    template <Side S> static Vector2 orient(Vector2 v);
+    /**
+     * @brief Gets the edge that a node adds to the given half of the hull of its subtree, or twice the point of a leaf,
+     * in the co-ordinates of that half.
+     *
+     * @tparam S The half of the hull.
+     * @param v The index of the node.
+     * @return std::pair<Vector2, Vector2> The edge.
+     */
+    template <Side S> std::pair<Vector2, Vector2> edge(int v) const;
+    /**
+     * @brief Finds the tangent from a point right of a subtree to the given half of the hull of the subtree.
+     *
+     * @tparam S The half of the hull.
+     * @param v The index of the root of the subtree.
+     * @param q The point, in the co-ordinates of the half.
+     * @return Vector2 The point of the hull that all the points of the subtree are below or on the line from q to, in
+     * the co-ordinates of the half.
+     */
+    template <Side S> Vector2 tangent(int v, Vector2 q) const;
+    /**
+     * @brief Finds the bridge of the given half of the hulls of the two children of a node.
+     *
+     * @tparam S The half of the hull.
+     * @param v The index of the inner node.
+     * @return std::pair<Vector2, Vector2> The bridge.
+     */
+    template <Side S> std::pair<Vector2, Vector2> bridge(int v) const;
+    /**
+     * @brief Appends the points of the given half of the hull of a subtree that lie between two points, from left to
+     * right.
+     *
+     * @tparam S The half of the hull.
+     * @param v The index of the root of the subtree.
+     * @param lo The smallest point to append.
+     * @param hi The largest point to append.
+     * @param out The points of the half of the hull.
+     */
+    template <Side S> void report(int v, Vector2 lo, Vector2 hi, std::vector<Vector2> &out) const;
+    /**
+     * @brief Allocates a leaf.
+     *
+     * @param p The point of the leaf.
+     * @param count The number of copies of the point.
+     * @return int The index of the leaf.
+     */
+    int makeLeaf(Vector2 p, int count);
+    /**
+     * @brief Allocates an inner node and computes its bridges.
+     *
+     * @param left The index of the left child.
+     * @param right The index of the right child.
+     * @return int The index of the node.
+     */
+    int makeInner(int left, int right);
+    /**
+     * @brief Puts a node back on the free list.
+     *
+     * @param v The index of the node.
+     */
+    void freeNode(int v);
+    /**
+     * @brief Recomputes the height, the largest point and the bridges of an inner node from its children.
+     *
+     * @param v The index of the node.
+     */
+    void pull(int v);
+    /**
+     * @brief Rotates a subtree to the left.
+     *
+     * @param v The index of the root of the subtree.
+     * @return int The index of the new root.
+     */
+    int rotateLeft(int v);
+    /**
+     * @brief Rotates a subtree to the right.
+     *
+     * @param v The index of the root of the subtree.
+     * @return int The index of the new root.
+     */
+    int rotateRight(int v);
+    /**
+     * @brief Restores the balance of a subtree whose children are balanced and differ in height by at most 2, and
+     * recomputes its root.
+     *
+     * @param v The index of the root of the subtree.
+     * @return int The index of the new root.
+     */
+    int rebalance(int v);
+    /**
+     * @brief Builds a balanced subtree over a range of sorted points without duplicates.
+     *
+     * @param points The sorted points.
+     * @param counts The number of copies of every point.
+     * @param begin The index of the first point of the range.
+     * @param end One past the index of the last point of the range.
+     * @return int The index of the root of the subtree.
+     */
+    int build(const std::vector<Vector2> &points, const std::vector<int> &counts, int begin, int end);
+    /**
+     * @brief Adds a point to a subtree.
+     *
+     * @param v The index of the root of the subtree, -1 if it is empty.
+     * @param p The point.
+     * @return int The index of the new root.
+     */
+    int insert(int v, Vector2 p);
+    /**
+     * @brief Removes one copy of a point from a subtree.
+     *
+     * @param v The index of the root of the subtree.
+     * @param p The point.
+     * @param found Set to true if the point was there.
+     * @return int The index of the new root, -1 if the subtree is now empty.
+     */
+    int erase(int v, Vector2 p, bool &found);
+
+    /**
+     * @brief All the nodes, the ones not in the tree being on the free list.
+     *
+     */
+    std::vector<Node> nodes;
+    /**
+     * @brief The indices of the nodes that are free to be reused.
+     *
+     */
+    std::vector<int> freeNodes;
+    /**
+     * @brief The index of the root of the tree, -1 if it is empty.
+     *
+     */
+    int root = -1;
+    /**
+     * @brief The number of points, counting every copy of a point.
+     *
+     */
+    int pointCount = 0;
+};
+
+#endif // DYNAMIC_HULL_H
\ No newline at end of file
@@ -0,0 +1,137 @@
+/**
+ * @file hull_prefilter.h
+ * @brief Contains the declaration of the HullPrefilter class.
+ *
+ * This class discards the points that cannot be on the convex hull before any hull algorithm runs.
+ *
+ */
+#ifndef HULL_PREFILTER_H
+#define HULL_PREFILTER_H
+
+#include "raylib.h"
+#include <vector>
+
+/**
+ * @brief Represents the HullPrefilter class, an Akl-Toussaint style filter that can be put in front of any convex hull
+ * algorithm.
+ *
+ * The points furthest in a number of evenly spaced directions are on the convex hull, so every point strictly inside
+ * the polygon they form is not. For uniformly spread points that polygon covers nearly all of the hull, so only a small
+ * fraction of the points is left for the hull algorithm.
+ *
+ * Points on the boundary of the polygon are kept, so the hull of the filtered points, co-linear points included, is
+ * the hull of all the points. The kept points stay in their input order.
+ *
+ * Both passes over the points work on fixed size chunks, spread over the workers of the shared TaskScheduler, and
+ * their inner loops have no data dependent branches so the compiler can vectorize them.
+ *
+ * Usage:
+ * 1. Create an instance of the HullPrefilter class with the number of directions to use.
+ * 2. Call filter() with the points, and give the points it returns to the hull algorithm.
+ * 3. Call getDiscardedCount() to get how many points were discarded.
+ *
+ */
+class HullPrefilter
+{
+  public:
+    /**
+     * @brief The number of directions used by default, giving an octagon.
+     *
+     */
+    static const int DEFAULT_DIRECTION_COUNT = 8;
+    /**
+     * @brief The number of points in a chunk handed to a worker.
+     *
+     */
+    static const int CHUNK_SIZE = 1 << 16;
+
+    /**
+     * @brief Constructs a new Hull Prefilter object.
+     *
+     * @param directionCount The number of evenly spaced directions in which extreme points are looked for, at least 3.
+     */
+    HullPrefilter(int directionCount = DEFAULT_DIRECTION_COUNT);
+    /**
+     * @brief Discards the points strictly inside the polygon formed by the extreme points.
+     *
+     * @param points The points.
+     * @return std::vector<Vector2> The points that may be on the convex hull, in their input order.
+     */
+    std::vector<Vector2> filter(const std::vector<Vector2> &points);
+    /**
+     * @brief Discards the points strictly inside the polygon formed by the extreme points, reading their co-ordinates
+     * from separate arrays such as those of a mapped BinaryPointFile, so that only the points kept are copied.
+     *
+     * @param xs The x co-ordinates of the points.
+     * @param ys The y co-ordinates of the points.
+     * @param count The number of points.
+     * @return std::vector<Vector2> The points that may be on the convex hull, in their input order.
+     */
+    std::vector<Vector2> filter(const float *xs, const float *ys, int count);
+    /**
+     * @brief Gets the number of points discarded by the last call to filter().
+     *
+     * @return int The number of discarded points.
+     */
+    int getDiscardedCount() const;
+    /**
+     * @brief Gets the number of directions in which extreme points are looked for.
+     *
+     * @return int The number of directions.
+     */
+    int getDirectionCount() const;
+    /**
+     * @brief Gets the polygon of extreme points found by the last call to filter(), in counter-clockwise order without
+     * repeated points. It has fewer than 3 points when the points were too degenerate to discard any of them.
+     *
+     * @return const std::vector<Vector2>& The polygon.
+     */
+    const std::vector<Vector2> &getPolygon() const;
+
+  private:
+    /**
+     * @brief Discards the points strictly inside the polygon formed by the extreme points.
+     *
+     * @tparam Point The type of a function giving the point at an index.
+     * @param count The number of points.
+     * @param point The function giving the point at an index.
+     * @return std::vector<Vector2> The points that may be on the convex hull, in their input order.
+     */
+    template <typename Point> std::vector<Vector2> filterPoints(int count, Point point);
+    /**
+     * @brief Finds the index of the extreme point in every direction.
+     *
+     * @tparam Point The type of a function giving the point at an index.
+     * @param count The number of points.
+     * @param point The function giving the point at an index.
+     * @return std::vector<int> The index of the first point furthest in every direction.
+     */
+    template <typename Point> std::vector<int> findExtremes(int count, Point point) const;
+    /**
+     * @brief Tells whether a point is strictly inside HullPrefilter::polygon, by a margin covering the rounding error
+     * of the test.
+     *
+     * @param p The point.
+     * @return true If the point is strictly inside.
+     * @return false otherwise.
+     */
+    bool isInside(Vector2 p) const;
+
+    /**
+     * @brief The unit vectors of the directions.
+     *
+     */
+    std::vector<Vector2> directions;
+    /**
+     * @brief The polygon of extreme points found by the last call to filter().
+     *
+     */
+    std::vector<Vector2> polygon;
+    /**
+     * @brief The number of points discarded by the last call to filter().
+     *
+     */
+    int discardedCount = 0;
+};
+
+#endif // HULL_PREFILTER_H
\ No newline at end of file
@@ -0,0 +1,126 @@
+/**
+ * @file incremental_hull.h
+ * @brief Contains the declaration of the IncrementalHull class.
+ *
+ * This class keeps the convex hull of a growing set of points up to date as the points are added one at a time.
+ *
+ */
+#ifndef INCREMENTAL_HULL_H
+#define INCREMENTAL_HULL_H
+
+#include "raylib.h"
+#include <map>
+#include <vector>
+
+/**
+ * @brief Represents the IncrementalHull class, holding the convex hull of a set of points to which points are added
+ * one at a time.
+ *
+ * The hull is kept as its upper and lower chains, each one a balanced search tree of points ordered by x co-ordinate.
+ * A new point is tested against the two chain points around its x co-ordinate, so a point inside the hull is rejected
+ * in O(log h). Otherwise it is put into the chain and its neighbours are removed for as long as they no longer make the
+ * chain turn the right way, which is O(log h) amortized since every point is removed at most once.
+ *
+ * Like MonotoneChainEngine, points that lie on an edge of the hull are not part of it, and duplicate points are only
+ * taken once. Points cannot be removed; DynamicHull supports removals, at O(log^3 n) per point added or removed, so
+ * this class is the faster choice for as long as points are only added.
+ *
+ * Usage:
+ * 1. Create an instance of the IncrementalHull class, empty or with the points already there.
+ * 2. Call insert() for every new point.
+ * 3. Call getConvexHull() to get the points on the convex hull.
+ *
+ */
+class IncrementalHull
+{
+  public:
+    /**
+     * @brief Constructs a new Incremental Hull object with no points.
+     *
+     */
+    IncrementalHull();
+    /**
+     * @brief Constructs a new Incremental Hull object and adds the given points.
+     *
+     * @param points Set of input points.
+     */
+    IncrementalHull(const std::vector<Vector2> &points);
+    /**
+     * @brief Adds a point.
+     *
+     * @param p The point.
+     * @return true If the hull changed.
+     * @return false If the point was inside the hull or on its boundary.
+     */
+    bool insert(Vector2 p);
+    /**
+     * @brief Tells whether a point is inside the hull or on its boundary.
+     *
+     * @param p The point.
+     * @return true If the point is inside the hull or on its boundary.
+     * @return false otherwise.
+     */
+    bool contains(Vector2 p) const;
+    /**
+     * @brief Removes all the points.
+     *
+     */
+    void clear();
+    /**
+     * @brief Gets all the points on the convex hull.
+     *
+     * @return std::vector<Vector2> All the points on the convex hull, in clockwise order with y pointing up from the
+     * point with the smallest x and y co-ordinates, the same order as MonotoneChainEngine.
+     */
+    std::vector<Vector2> getConvexHull() const;
+
+  private:
+    /**
+     * @brief A chain of the hull, mapping the x co-ordinate of every point to its y co-ordinate. The lower chain keeps
+     * the y co-ordinates negated, so that both chains are upper chains and share their code.
+     *
+     */
+    typedef std::map<float, float> Chain;
+
+    /**
+     * @brief Computes the cross product of the vectors from o to a and from o to b, positive when o, a and b turn
+     * counter-clockwise with y pointing up.
+     *
+     * @param o The common origin.
+     * @param a The end of the first vector.
+     * @param b The end of the second vector.
+     * @return float The cross product.
+     */
+    static float cross(Vector2 o, Vector2 a, Vector2 b);
+    /**
+     * @brief Adds a point to an upper chain, removing the points it hides.
+     *
+     * @param chain The chain.
+     * @param p The point.
+     * @return true If the chain changed.
+     * @return false If the point was below the chain or on it.
+     */
+    static bool insertUpper(Chain &chain, Vector2 p);
+    /**
+     * @brief Tells whether a point is below an upper chain or on it, within its range of x co-ordinates.
+     *
+     * @param chain The chain.
+     * @param p The point.
+     * @return true If the point is below the chain or on it.
+     * @return false otherwise.
+     */
+    static bool isBelowUpper(const Chain &chain, Vector2 p);
+
+    /**
+     * @brief The upper chain of the hull.
+     *
+     */
+    Chain upper;
+    /**
+     * @brief The lower chain of the hull, with its y co-ordinates negated.
+     *
+     */
+    Chain lower;
+};
+
+#endif // INCREMENTAL_HULL_H
\ No newline at end of file
@@ -9,120 +9,42 @@
 #define JARVIS_MARCH_H
 
 #include "convex_hull.h"
+#include "jarvis_march_engine.h"
+#include "lazy_step_log.h"
 
 /**
  * @brief Represents the JarvisMarch class, implementing the Jarvis March algorithm for computing the convex hull of a
  * set of points.
  *
+ * The computation itself is done by JarvisMarchEngine, while this class draws its steps. The steps are generated
+ * lazily by the coroutine of the engine as they are asked for, so the first step is drawn without waiting for the
+ * whole computation, and only a LazyStepLog of recent steps and checkpoints is kept in memory.
+ *
  * Usage:
  * 1. Create an instance of the JarvisMarch class with the points to be used to compute the convex hull. The convex hull
- * is computed in the constructor.
+ * is computed step by step as the steps are asked for.
  * 2. Call the next() or previous() method to get the next or previous step in the convex hull computation process.
  * 3. Call the draw() method to draw the current step of the convex hull computation process.
  *
  */
-class JarvisMarch : public ConvexHullAlgorithm
+class JarvisMarch : public ConvexHullAlgorithm, private JarvisMarchEngine<Record>
 {
   private:
-    /**
-     * @brief Represents the orientation of any three points.
-     *
-     */
-    enum Orientation
-    {
-        COLLINEAR,
-        CLOCKWISE,
-        COUNTER_CLOCKWISE
-    };
     /**
      * @brief Draws the convex hull using the points in JarvisMarch::convexHull.
      *
      */
     void drawConvexHull();
-    /**
-     * @brief Represents the convex hull.
-     *
-     */
-    std::vector<Vector2> convexHull;
-    /**
-     * @brief Represents information about a step in the Jarvis March algorithm.
-     *
-     *
-     */
-    struct JarvisMarchStep
-    {
-        /**
-         * @brief The index of the current point.
-         *
-         * This member variable stores the index of the current point being processed in the Jarvis March algorithm.
-         */
-        int currentPointIndex;
-
-        /**
-         * @brief The index of the next point.
-         *
-         * This member variable stores the index of the next point that forms the convex hull in the Jarvis March
-         * algorithm.
-         */
-        int nextPointIndex;
-
-        /**
-         * @brief The index of the candidate point.
-         *
-         * This member variable stores the index of the candidate point being considered for inclusion in the convex
-         * hull during the Jarvis March algorithm.
-         */
-        int candidatePointIndex;
-
-        /**
-         * @brief The current state of the convex hull.
-         *
-         * This member variable stores the current state of the convex hull being constructed during the Jarvis March
-         * algorithm.
-         */
-        std::vector<Vector2> convexHull;
-    };
-    /**
-     * @brief The collection of points to be used to compute the convex hull.
-     *
-     */
-    std::vector<Vector2> points;
-    /**
-     * @brief Gets the index of the left most point in JarvisMarch::points.
-     *
-     * @return int The index of the left most point.
-     */
-    int getLeftMostPointIndex();
-    /**
-     * @brief Represents the size of the JarvisMarch::points.
-     *
-     */
-    int n;
-    /**
-     * @brief Computes the orientation of three points.
-     *
-     * @param p The first point (Vector2) in consideration.
-     * @param q The second point (Vector2) in consideration.
-     * @param r The third point (Vector2) in consideration.
-     * @return Orientation The orientation of the three points.
-     */
-    Orientation orientation(Vector2 p, Vector2 q, Vector2 r);
-    /**
-     * @brief Represents the steps in the convex hull computation process of the JarvisMarch object computed using
-     * JarvisMarch::computeNextStep.
-     *
-     */
-    std::vector<JarvisMarchStep> steps;
     /**
      * @brief Represents the current step in the JarvisMarch object.
      *
      */
     int currentStep;
     /**
-     * @brief Computes all the steps in the convex hull computation process.
+     * @brief The steps generated so far.
      *
      */
-    void computeConvexHull();
+    LazyStepLog<JarvisMarchStep> stepLog;
 
   public:
     /**
@@ -137,7 +59,7 @@ class JarvisMarch : public ConvexHullAlgorithm
      */
     ~JarvisMarch();
     /**
-     * @brief Checks if the JarvisMarch object has reached the last step in JarvisMarch::steps.
+     * @brief Checks if the JarvisMarch object has reached the last step in JarvisMarch::stepLog.
      *
      * @return true If the JarvisMarch object has reached the last step.
      * @return false If the JarvisMarch object has not reached the last step.
@@ -159,9 +81,10 @@ class JarvisMarch : public ConvexHullAlgorithm
      */
     void previous();
     /**
-     * @brief Gets the number of steps in the convex hull computation process.
+     * @brief Gets the number of steps in the convex hull computation process, as far as they have been generated. Until
+     * the last step is generated, this is one more than the current step at least.
      *
-     * @return int The number of steps.
+     * @return int The number of steps known.
      */
     int getNumberOfSteps();
     /**
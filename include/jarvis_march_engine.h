@@ -0,0 +1,181 @@
+/**
+ * @file jarvis_march_engine.h
+ * @brief Contains the declaration of the JarvisMarchEngine class template.
+ *
+ * This class implements the computation of the Jarvis March algorithm without any drawing, so that it can be used
+ * both by the visualizer and by headless programs.
+ *
+ */
+#ifndef JARVIS_MARCH_ENGINE_H
+#define JARVIS_MARCH_ENGINE_H
+
+#include "raylib.h"
+#include "step_generator.h"
+#include "step_recording.h"
+#include <vector>
+
+/**
+ * @brief Represents the JarvisMarchEngine class, implementing the Jarvis March algorithm for computing the convex hull
+ * of a set of points.
+ *
+ * Usage:
+ * 1. Create an instance of the JarvisMarchEngine class with the points to be used to compute the convex hull. The
+ * convex hull is computed in the constructor, unless it is asked to be lazy.
+ * 2. Call the getConvexHull() method to get the points on the convex hull.
+ *
+ * A lazy engine computes nothing up front: its derived classes run generateSteps() to compute the steps, and so the
+ * convex hull, as they are needed.
+ *
+ * @tparam Recording The step recording policy, Record to record the steps for the visualizer or NoRecord to skip them.
+ */
+template <typename Recording> class JarvisMarchEngine
+{
+  public:
+    /**
+     * @brief Constructs a new Jarvis March Engine object and computes the convex hull.
+     *
+     * @param points The set of points to be used to compute the convex hull.
+     * @param lazy If true, the convex hull is not computed in the constructor but by generateSteps().
+     */
+    JarvisMarchEngine(std::vector<Vector2> points, bool lazy = false);
+    /**
+     * @brief Gets all the points on the final convex hull.
+     *
+     * @return const std::vector<Vector2>& All the points on the convex hull.
+     */
+    const std::vector<Vector2> &getConvexHull() const;
+
+  protected:
+    /**
+     * @brief Represents the orientation of any three points.
+     *
+     */
+    enum Orientation
+    {
+        COLLINEAR,
+        CLOCKWISE,
+        COUNTER_CLOCKWISE
+    };
+    /**
+     * @brief Represents information about a step in the Jarvis March algorithm.
+     *
+     *
+     */
+    struct JarvisMarchStep
+    {
+        /**
+         * @brief The index of the current point.
+         *
+         * This member variable stores the index of the current point being processed in the Jarvis March algorithm.
+         */
+        int currentPointIndex;
+
+        /**
+         * @brief The index of the next point.
+         *
+         * This member variable stores the index of the next point that forms the convex hull in the Jarvis March
+         * algorithm.
+         */
+        int nextPointIndex;
+
+        /**
+         * @brief The index of the candidate point.
+         *
+         * This member variable stores the index of the candidate point being considered for inclusion in the convex
+         * hull during the Jarvis March algorithm.
+         */
+        int candidatePointIndex;
+
+        /**
+         * @brief The number of points of the convex hull found so far.
+         *
+         * The hull is built one point at a time, so the partial hull of a step is the first hullLength points of
+         * JarvisMarchEngine::convexHull, which keeps every step the same small size.
+         */
+        int hullLength;
+    };
+    /**
+     * @brief The collection of points to be used to compute the convex hull.
+     *
+     */
+    std::vector<Vector2> points;
+    /**
+     * @brief Represents the size of the JarvisMarchEngine::points.
+     *
+     */
+    int n;
+    /**
+     * @brief The index of the left most point in JarvisMarchEngine::points, where the march starts and ends.
+     *
+     */
+    int leftMostPointIndex = 0;
+    /**
+     * @brief Represents the convex hull.
+     *
+     */
+    std::vector<Vector2> convexHull;
+    /**
+     * @brief Represents the steps in the convex hull computation process, only filled when recording.
+     *
+     */
+    std::vector<JarvisMarchStep> steps;
+    /**
+     * @brief Gets the index of the left most point in JarvisMarchEngine::points.
+     *
+     * @return int The index of the left most point.
+     */
+    int getLeftMostPointIndex();
+    /**
+     * @brief Computes the orientation of three points.
+     *
+     * @param p The first point (Vector2) in consideration.
+     * @param q The second point (Vector2) in consideration.
+     * @param r The third point (Vector2) in consideration.
+     * @return Orientation The orientation of the three points.
+     */
+    Orientation orientation(Vector2 p, Vector2 q, Vector2 r);
+    /**
+     * @brief Checks whether a candidate replaces the next point of the hull, which it does if it is counter clockwise
+     * of it, or on the same line and farther away, so that points lying on an edge and copies of the current point are
+     * never chosen.
+     *
+     * @param current The current point of the hull.
+     * @param candidate The candidate point.
+     * @param next The next point of the hull found so far.
+     * @return true If the candidate becomes the next point.
+     * @return false otherwise.
+     */
+    bool replacesNext(Vector2 current, Vector2 candidate, Vector2 next);
+    /**
+     * @brief Checks whether the march is back at the left most point, or at a copy of it.
+     *
+     * @param index The index of the current point.
+     * @return true If the point is the left most point.
+     * @return false otherwise.
+     */
+    bool isLeftMostPoint(int index) const;
+    /**
+     * @brief Computes the convex hull, recording all the steps in the process if the policy asks for it.
+     *
+     */
+    void computeConvexHull();
+    /**
+     * @brief Gets the first step of the computation, from which generateSteps() starts.
+     *
+     * @return JarvisMarchStep The first step.
+     */
+    JarvisMarchStep getFirstStep() const;
+    /**
+     * @brief Runs the computation as a coroutine yielding every step, resuming it at the given step.
+     *
+     * A step holds the whole state of the march, so the computation can be resumed at any step it yielded before,
+     * yielding that step again first. Points are added to JarvisMarchEngine::convexHull the first time the march gets
+     * to them, so the partial hull of every yielded step is already in it.
+     *
+     * @param from The step to resume at, getFirstStep() to start from the beginning.
+     * @return StepGenerator<JarvisMarchStep> The generator yielding the steps from the given one to the last one.
+     */
+    StepGenerator<JarvisMarchStep> generateSteps(JarvisMarchStep from);
+};
+
+#endif // JARVIS_MARCH_ENGINE_H
\ No newline at end of file
@@ -0,0 +1,377 @@
+/**
+ * @file kirk_patrick_seidel_engine.h
+ * @brief Contains the declaration of the KirkpatrickSeidelEngine class template.
+ *
+ * This class implements the computation of the Kirkpatrick-Seidel algorithm without any drawing, so that it can be
+ * used both by the visualizer and by headless programs.
+ *
+ */
+#ifndef KIRK_PATRICK_SEIDEL_ENGINE_H
+#define KIRK_PATRICK_SEIDEL_ENGINE_H
+
+#include "raylib.h"
+#include "raymath.h"
+#include "step_recording.h"
+#include "task_scheduler.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Represents the KirkpatrickSeidelEngine class, implementing the Kirkpatrick-Seidel algorithm for computing the
+ * convex hull of a set of points.
+ *
+ * Usage:
+ * 1. Create an instance of the KirkpatrickSeidelEngine class with the points to be used to compute the convex hull.
+ * The convex hull is computed in the constructor.
+ * 2. Call the getConvexHull() method to get the points on the convex hull.
+ *
+ * @tparam Recording The step recording policy, Record to record the steps for the visualizer or NoRecord to skip them.
+ */
+template <typename Recording> class KirkpatrickSeidelEngine
+{
+  public:
+    /**
+     * @brief Represents the sub/mini state during a step in the algorithm.
+     *
+     */
+    enum miniState
+    {
+        LINE,
+        PAIRS,
+        INTERCEPTS,
+        MEDIAN_SLOPE,
+        INTERCEPTS_FINAL,
+        ADD_TO_CANDIDATES,
+        UP_BRIDGE,
+        LOW_BRIDGE,
+        OVER
+    };
+
+    /**
+     * @brief Represents the state during a step in the algorithm.
+     *
+     */
+    enum State
+    {
+        INIT,
+        UPPER_HULL,
+        LOWER_HULL,
+        MERGE,
+        FINISH
+    };
+
+    /**
+     * @brief Ranges with fewer points than this are not split between the workers of the TaskScheduler by default.
+     *
+     */
+    static const int DEFAULT_GRAIN_SIZE = 4096;
+
+    /**
+     * @brief Constructs a new Kirkpatrick Seidel Engine object and computes the convex hull.
+     *
+     * @param p Set of input points.
+     * @param grainSize Ranges with fewer points than this are computed serially instead of being split between the
+     * workers of the shared TaskScheduler.
+     * @param cancelled A flag another thread can set to stop the computation, checked at every level of the recursion,
+     * or nullptr.
+     */
+    KirkpatrickSeidelEngine(std::vector<Vector2> p, int grainSize = DEFAULT_GRAIN_SIZE,
+                            const std::atomic<bool> *cancelled = nullptr);
+    /**
+     * @brief Gets all the points on the final convex hull.
+     *
+     * @return const std::vector<Vector2>& All the points on the convex hull, none if the computation was cancelled.
+     */
+    const std::vector<Vector2> &getConvexHull() const;
+    /**
+     * @brief Checks whether the computation was cancelled through the flag given to the constructor.
+     *
+     * @return true If the flag is set, in which case the convex hull may be empty.
+     * @return false otherwise.
+     */
+    bool isCancelled() const;
+    /**
+     * @brief Comparator function for Vector2. A vector is defined as smaller than another if it has a smaller X
+     * coordinate. For equal X coordinates, the one with the smaller Y coordinate is considered smaller.
+     *
+     * @param a The first Vector2 operand.
+     * @param b The second Vector2 operand.
+     * @return true if (a < b).
+     * @return false otherwise.
+     */
+    static bool compareVector2(Vector2 a, Vector2 b);
+
+  protected:
+    struct HullContext;
+    struct Scratch;
+
+    /**
+     * @brief Gets a point as seen while computing the given half of the hull. The lower hull is computed as the upper
+     * hull of the points mirrored about the x axis, so its routines read the y co-ordinates negated.
+     *
+     * @tparam Side UPPER_HULL or LOWER_HULL.
+     * @param v The point.
+     * @return Vector2 The point, mirrored for the lower hull.
+     */
+    template <State Side> static Vector2 orient(Vector2 v);
+    /**
+     * @brief Compares two points with KirkpatrickSeidelEngine::compareVector2 as seen while computing the given half of
+     * the hull.
+     *
+     * @tparam Side UPPER_HULL or LOWER_HULL.
+     * @param a The first Vector2 operand.
+     * @param b The second Vector2 operand.
+     * @return true if (a < b) after orienting them.
+     * @return false otherwise.
+     */
+    template <State Side> static bool compareOriented(Vector2 a, Vector2 b);
+    /**
+     * @brief Calculates the bridge of the given half of the hull for the points in the given range of the working
+     * buffer of the context.
+     *
+     * The points that survive each pruning round are compacted into one of the two candidate buffers of the scratch,
+     * alternating between them, so no new vectors are built per round.
+     *
+     * @tparam Side UPPER_HULL for the upper bridge, LOWER_HULL for the lower bridge.
+     * @param context The context of the half of the hull being computed.
+     * @param scratch The scratch arrays of the calling worker.
+     * @param begin Index of the first point in the range.
+     * @param end Index one past the last point in the range.
+     * @param L The middle vertical line.
+     * @return std::pair<Vector2, Vector2> Points on the bridge, sorted using
+     * KirkpatrickSeidelEngine::compareOriented.
+     */
+    template <State Side>
+    std::pair<Vector2, Vector2> bridge(HullContext &context, Scratch &scratch, int begin, int end, float L);
+    /**
+     * @brief Calculates the given half of the hull for the points in the given range of the working buffer of the
+     * context.
+     *
+     * The range is partitioned in place around the bridge, so the recursive calls work on sub-ranges of the same
+     * buffer instead of copies of the points. When not recording, the recursive calls on ranges of at least
+     * KirkpatrickSeidelEngine::grainSize points run in parallel on the TaskScheduler.
+     *
+     * @tparam Side UPPER_HULL for the upper hull, LOWER_HULL for the lower hull.
+     * @param context The context of the half of the hull being computed.
+     * @param begin Index of the first point in the range.
+     * @param end Index one past the last point in the range.
+     * @param out Array with room for end - begin points, to which the points on the half of the hull are written.
+     * @return int The number of points on the half of the hull.
+     */
+    template <State Side> int halfHull(HullContext &context, int begin, int end, Vector2 *out);
+    /**
+     * @brief Moves the recorded steps and bridges of both halves into KirkpatrickSeidelEngine::steps and the bridge
+     * arrays, upper hull first, fixing up the indices held by the lower hull steps.
+     *
+     * @param upper The context of the upper hull.
+     * @param lower The context of the lower hull.
+     */
+    void spliceSteps(HullContext &upper, HullContext &lower);
+    /**
+     * @brief Calculates the convex hull for a given set of points.
+     *
+     * The upper and lower hulls are computed concurrently on the TaskScheduler when there are at least
+     * KirkpatrickSeidelEngine::grainSize points.
+     *
+     * @param S Given set of points.
+     * @return std::vector<Vector2> Points on the convex hull.
+     */
+    std::vector<Vector2> convexHull(std::vector<Vector2> &S);
+
+    /**
+     * @brief The collection of points to be used to compute the convex hull.
+     *
+     */
+    std::vector<Vector2> points;
+    /**
+     * @brief The calculated convex hull.
+     *
+     */
+    std::vector<Vector2> hull;
+    /**
+     * @brief The calculated upper hull for visualization, only filled when recording.
+     *
+     */
+    std::vector<Vector2> upperHullV;
+    /**
+     * @brief Array of all calculated upper bridges, only filled when recording.
+     *
+     */
+    std::vector<std::pair<Vector2, Vector2>> upperBridges;
+    /**
+     * @brief Array of all calculated lower bridges, only filled when recording.
+     *
+     */
+    std::vector<std::pair<Vector2, Vector2>> lowerBridges;
+
+    /**
+     * @brief Holds the current state during a step in the algorithm.
+     *
+     */
+    State currentState = State::INIT;
+
+    /**
+     * @brief Represents information about a step in the Kirkpatric Seidel algorithm.
+     *
+     */
+    struct KirkpatrickSeidelStep
+    {
+        /**
+         * @brief State of the step.
+         *
+         */
+        State state;
+        /**
+         * @brief Mini/Sub State of the step.
+         *
+         */
+        miniState type;
+        /**
+         * @brief Holds various values depending upon the State and miniState.
+         *
+         */
+        std::vector<Vector2> arr;
+        /**
+         * @brief Holds pairs of points formed during pairing step.
+         *
+         */
+        std::vector<Vector2> pairs;
+        /**
+         * @brief Points that form the median slope pair.
+         *
+         */
+        Vector2 p_k, p_m;
+        /**
+         * @brief x co-ordinate of the middle vertical line.
+         *
+         */
+        float x_m = 0;
+        /**
+         * @brief Slope.
+         *
+         */
+        float k = 0;
+        /**
+         * @brief Index of the latest step with miniState LINE.
+         *
+         */
+        int hullLineIndex = 0;
+        /**
+         * @brief Index upto which upperBridgeLine needs to be drawn for the current step.
+         *
+         */
+        int upperBridgeLineIndex = 0;
+        /**
+         * @brief Index upto which lowerBridgeLine needs to be drawn for the current step.
+         *
+         */
+        int lowerBridgeLineIndex = 0;
+    };
+
+    /**
+     * @brief Holds steps in the computation of convex hull, only filled when recording.
+     *
+     */
+    std::vector<KirkpatrickSeidelStep> steps;
+
+    /**
+     * @brief Holds everything that the computation of one half of the hull writes to, apart from the scratch arrays,
+     * so that the upper and lower hulls can be computed on separate threads.
+     *
+     */
+    struct HullContext
+    {
+        /**
+         * @brief The half of the hull being computed, either UPPER_HULL or LOWER_HULL.
+         *
+         */
+        State state = State::INIT;
+        /**
+         * @brief Steps recorded while computing this half.
+         *
+         */
+        std::vector<KirkpatrickSeidelStep> steps;
+        /**
+         * @brief Upper bridges found while computing this half.
+         *
+         */
+        std::vector<std::pair<Vector2, Vector2>> upperBridges;
+        /**
+         * @brief Lower bridges found while computing this half.
+         *
+         */
+        std::vector<std::pair<Vector2, Vector2>> lowerBridges;
+        /**
+         * @brief Helper variable to calculate upperBridgeLine for a Step object.
+         *
+         */
+        int hullLineIndexHelper = 0;
+        /**
+         * @brief The working buffer of points that the hull recursion partitions in place.
+         *
+         */
+        std::vector<Vector2> work;
+    };
+
+    /**
+     * @brief Holds the scratch arrays of one worker thread, which are only used while a range is being split.
+     *
+     */
+    struct Scratch
+    {
+        /**
+         * @brief Scratch array reused by every call to Selection, so that finding medians does not allocate.
+         *
+         */
+        std::vector<float> selectionScratch;
+        /**
+         * @brief The two buffers that KirkpatrickSeidelEngine::bridge() alternates between for its candidate
+         * points.
+         *
+         */
+        std::vector<Vector2> bridgeCandidates[2];
+        /**
+         * @brief The slope of every pair made in KirkpatrickSeidelEngine::bridge(), in the order of the pairs.
+         *
+         */
+        std::vector<float> pairSlopes;
+        /**
+         * @brief Holds the points right of the bridge while KirkpatrickSeidelEngine::halfHull() partitions its range.
+         *
+         */
+        std::vector<Vector2> partitionScratch;
+        /**
+         * @brief Holds the points lying on the bridge while KirkpatrickSeidelEngine::halfHull() partitions its range.
+         *
+         */
+        std::vector<Vector2> bridgePoints;
+    };
+
+    /**
+     * @brief Ranges with fewer points than this are computed serially.
+     *
+     */
+    int grainSize;
+    /**
+     * @brief The flag that stops the computation once it is set, or nullptr.
+     *
+     */
+    const std::atomic<bool> *cancelled;
+    /**
+     * @brief The scheduler that runs the parallel parts of the computation.
+     *
+     */
+    TaskScheduler *scheduler = nullptr;
+    /**
+     * @brief The scratch arrays of every worker of KirkpatrickSeidelEngine::scheduler, at the index of the worker plus
+     * one, with the first one used by threads outside the scheduler.
+     *
+     */
+    std::vector<Scratch> workerScratch;
+};
+
+#endif // KIRK_PATRICK_SEIDEL_ENGINE_H
\ No newline at end of file
@@ -0,0 +1,174 @@
+/**
+ * @file lazy_step_log.h
+ * @brief Contains the declaration of the LazyStepLog class template.
+ *
+ * This class gives random access to the steps of an algorithm that are generated lazily by a StepGenerator.
+ *
+ */
+#ifndef LAZY_STEP_LOG_H
+#define LAZY_STEP_LOG_H
+
+#include "step_generator.h"
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Represents the LazyStepLog class template, a log of steps that are only generated when they are asked for.
+ *
+ * Only a ring of the most recently generated steps is kept, along with a checkpoint every
+ * LazyStepLog::checkpointInterval steps. A step that has fallen out of the ring is found again by resuming the
+ * algorithm from the nearest checkpoint before it, so going back or seeking costs at most one checkpoint interval of
+ * steps, while the memory used grows with the number of checkpoints only.
+ *
+ * A step must hold everything needed to resume the algorithm from it, and the algorithm must yield the same steps
+ * every time it is resumed from the same one.
+ *
+ * Usage:
+ * 1. Create an instance of the LazyStepLog class with the first step and a function resuming the algorithm from a
+ * step, which yields that step first.
+ * 2. Call get() with the index of a step to generate it if needed and get it.
+ * 3. Call isComplete() and getKnownCount() to find out how many steps there are so far.
+ *
+ * @tparam Step The type of the steps.
+ */
+template <typename Step> class LazyStepLog
+{
+  public:
+    /**
+     * @brief A function returning a generator that resumes the algorithm at the given step, yielding that step first.
+     *
+     */
+    using Resume = std::function<StepGenerator<Step>(const Step &)>;
+
+    /**
+     * @brief The number of steps between two checkpoints by default.
+     *
+     */
+    static const int DEFAULT_CHECKPOINT_INTERVAL = 1024;
+
+    /**
+     * @brief Constructs a new Lazy Step Log object. No step is generated until one is asked for.
+     *
+     * @param first The first step.
+     * @param resume The function resuming the algorithm at a step.
+     * @param checkpointInterval The number of steps between two checkpoints, which is also the size of the ring of
+     * recent steps.
+     */
+    LazyStepLog(Step first, Resume resume, int checkpointInterval = DEFAULT_CHECKPOINT_INTERVAL)
+        : resume(std::move(resume)), checkpointInterval(std::max(1, checkpointInterval)), ring(this->checkpointInterval)
+    {
+        checkpoints.push_back(std::move(first));
+    }
+
+    /**
+     * @brief Gets a step, generating it first if needed. Past the last step, the last step is returned.
+     *
+     * @param index The index of the step, from 0.
+     * @return const Step& The step, valid until the next call to get().
+     */
+    const Step &get(int index)
+    {
+        if (complete)
+            index = std::min(index, knownCount - 1);
+        index = std::max(index, 0);
+
+        // resume from the nearest checkpoint when the step has fallen out of the ring, or when that checkpoint is
+        // further along than the generator
+        int checkpoint = std::min<int>(index / checkpointInterval, checkpoints.size() - 1);
+        if (filled == 0 || index < position - filled || checkpoint * checkpointInterval > position)
+        {
+            generator = resume(checkpoints[checkpoint]);
+            position = checkpoint * checkpointInterval;
+            filled = 0;
+        }
+
+        while (position <= index)
+        {
+            if (!generator.next())
+            {
+                complete = true;
+                knownCount = position;
+                break;
+            }
+            const Step &step = generator.current();
+            bool newCheckpoint = position / checkpointInterval == static_cast<int>(checkpoints.size());
+            if (position % checkpointInterval == 0 && newCheckpoint)
+                checkpoints.push_back(step);
+            ring[position % checkpointInterval] = step;
+            filled = std::min(filled + 1, checkpointInterval);
+            position++;
+            knownCount = std::max(knownCount, position);
+        }
+
+        return ring[std::min(index, position - 1) % checkpointInterval];
+    }
+    /**
+     * @brief Gets the number of steps generated so far, which is the number of steps once the log is complete.
+     *
+     * @return int The number of steps known.
+     */
+    int getKnownCount() const
+    {
+        return knownCount;
+    }
+    /**
+     * @brief Tells whether the algorithm has run to its end, so that the number of steps is known.
+     *
+     * @return true If all steps have been generated at least once.
+     * @return false otherwise.
+     */
+    bool isComplete() const
+    {
+        return complete;
+    }
+
+  private:
+    /**
+     * @brief The function resuming the algorithm at a step.
+     *
+     */
+    Resume resume;
+    /**
+     * @brief The number of steps between two checkpoints.
+     *
+     */
+    int checkpointInterval;
+    /**
+     * @brief The step at every multiple of LazyStepLog::checkpointInterval generated so far.
+     *
+     */
+    std::vector<Step> checkpoints;
+    /**
+     * @brief The most recently generated steps, the step at index i being at i modulo its size.
+     *
+     */
+    std::vector<Step> ring;
+    /**
+     * @brief The generator currently running the algorithm.
+     *
+     */
+    StepGenerator<Step> generator;
+    /**
+     * @brief The index of the next step the generator yields.
+     *
+     */
+    int position = 0;
+    /**
+     * @brief The number of steps before LazyStepLog::position that are in the ring.
+     *
+     */
+    int filled = 0;
+    /**
+     * @brief The number of steps generated so far.
+     *
+     */
+    int knownCount = 0;
+    /**
+     * @brief Whether the algorithm has run to its end.
+     *
+     */
+    bool complete = false;
+};
+
+#endif // LAZY_STEP_LOG_H
\ No newline at end of file
@@ -0,0 +1,162 @@
+/**
+ * @file mapped_file.h
+ * @brief Contains the declaration of the MappedFile class.
+ *
+ * This class maps a file into memory for reading.
+ *
+ */
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <fstream>
+#endif
+
+/**
+ * @brief Represents the MappedFile class, giving read only access to the contents of a file without reading it
+ * through a stream.
+ *
+ * The file is mapped with mmap, so its pages are only read from the disk when they are first touched and can be
+ * dropped again by the system under memory pressure. On Windows, where there is no mmap, the file is read into memory
+ * instead, and so is a pipe such as the standard input, which cannot be mapped. Either way the contents start at an
+ * address aligned for any fundamental type.
+ *
+ * A file that is read into memory can also be read a block at a time, so that only the part of it not yet used is
+ * held: open() then reads the first block, and readMore() drops the start of what is held and reads the next block.
+ *
+ * Usage:
+ * 1. Create an instance of the MappedFile class and call open() with the path of the file.
+ * 2. Call getData() and getSize() to get the contents.
+ * 3. If open() was given a block size, call readMore() until isComplete(), or readRest() to read everything left.
+ *
+ */
+class MappedFile
+{
+  public:
+    /**
+     * @brief Constructs a new Mapped File object with no file open.
+     *
+     */
+    MappedFile();
+    /**
+     * @brief Destroys the Mapped File object, unmapping the file.
+     *
+     */
+    ~MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /**
+     * @brief Maps a file, closing the one open before.
+     *
+     * @param filePath The path to the file.
+     * @param blockSize If the file cannot be mapped, the number of bytes read at first, the rest being left to
+     * readMore() and readRest(), or 0 to read it whole.
+     * @return true If the file could be opened and mapped or read.
+     * @return false otherwise.
+     */
+    bool open(const std::string &filePath, size_t blockSize = 0);
+    /**
+     * @brief Drops the start of the contents held of a file read a block at a time, and reads the next block after
+     * the rest. Does nothing once the whole file has been read.
+     *
+     * @param keep The offset in the contents held of the first byte to keep.
+     * @return true If the next block was read, or there was nothing left to read.
+     * @return false If the file could not be read, in which case it is closed.
+     */
+    bool readMore(size_t keep);
+    /**
+     * @brief Reads everything left of a file read a block at a time, after the contents held.
+     *
+     * @return true If the file was read to its end.
+     * @return false otherwise, in which case it is closed.
+     */
+    bool readRest();
+    /**
+     * @brief Checks whether the contents held go to the end of the file.
+     *
+     * @return true If the file is mapped or was read to its end.
+     * @return false If there are blocks left for readMore().
+     */
+    bool isComplete() const;
+    /**
+     * @brief Unmaps the file.
+     *
+     */
+    void close();
+    /**
+     * @brief Exchanges the files of two Mapped File objects.
+     *
+     * @param other The other object.
+     */
+    void swap(MappedFile &other);
+    /**
+     * @brief Gets the contents of the file.
+     *
+     * @return const char* The first byte of the contents held, nullptr if there are none or no file is open.
+     */
+    const char *getData() const;
+    /**
+     * @brief Gets the size of the contents of the file.
+     *
+     * @return size_t The size of the contents held in bytes, the size of the file unless it is read a block at a
+     * time, 0 if no file is open.
+     */
+    size_t getSize() const;
+
+  private:
+    /**
+     * @brief Reads a file that cannot be mapped into MappedFile::buffer after the contents held, until they reach a
+     * size or the end of the file.
+     *
+     * @param capacity The size to reach in bytes.
+     * @return true If the size or the end of the file was reached.
+     * @return false otherwise, in which case the file is closed.
+     */
+    bool fill(size_t capacity);
+
+    /**
+     * @brief The start of the mapping of the file, nullptr when the file is not mapped.
+     *
+     */
+    void *mapping = nullptr;
+    /**
+     * @brief The size of the file in bytes.
+     *
+     */
+    size_t size = 0;
+    /**
+     * @brief The contents of the file when it cannot be mapped, in doubles so that they are aligned.
+     *
+     */
+    std::vector<double> buffer;
+    /**
+     * @brief The number of bytes read by readMore() when the file is read a block at a time.
+     *
+     */
+    size_t blockSize = 0;
+    /**
+     * @brief Whether the contents held go to the end of the file.
+     *
+     */
+    bool complete = true;
+#if defined(_WIN32)
+    /**
+     * @brief The file being read, open until its end is reached.
+     *
+     */
+    std::ifstream stream;
+#else
+    /**
+     * @brief The descriptor of the file being read, open until its end is reached, -1 otherwise.
+     *
+     */
+    int descriptor = -1;
+#endif
+};
+
+#endif // MAPPED_FILE_H
\ No newline at end of file
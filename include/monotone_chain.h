@@ -0,0 +1,125 @@
+/**
+ * @file monotone_chain.h
+ * @brief Contains the declaration of the MonotoneChain class.
+ *
+ * This class implements Andrew's monotone chain algorithm to compute the convex hull of a set of points.
+ *
+ */
+#ifndef MONOTONE_CHAIN_H
+#define MONOTONE_CHAIN_H
+
+#include "convex_hull.h"
+#include "monotone_chain_engine.h"
+
+/**
+ * @brief Represents the MonotoneChain class, implementing Andrew's monotone chain algorithm for computing the convex
+ * hull of a set of points.
+ *
+ * The computation itself is done by MonotoneChainEngine, with every step recorded, while this class draws the recorded
+ * steps.
+ *
+ * Usage:
+ * 1. Create an instance of the MonotoneChain class with the points to be used to compute the convex hull. The convex
+ * hull is computed in the constructor.
+ * 2. Call the next() or previous() method to get the next or previous step in the convex hull computation process.
+ * 3. Call the draw() method to draw the current step of the convex hull computation process.
+ *
+ */
+class MonotoneChain : public ConvexHullAlgorithm, private MonotoneChainEngine<Record>
+{
+  public:
+    /**
+     * @brief Constructs a new Monotone Chain object.
+     *
+     * @param p Set of input points.
+     */
+    MonotoneChain(std::vector<Vector2> p);
+    /**
+     * @brief Destroys the Monotone Chain object.
+     *
+     */
+    ~MonotoneChain();
+
+    /**
+     * @brief Draws the MonotoneChain::currentStep of the MonotoneChain object.
+     *
+     */
+    void draw();
+    /**
+     * @brief Gets the next step of the MonotoneChain object.
+     *
+     */
+    void next();
+    /**
+     * @brief Gets the previous step of the MonotoneChain object.
+     *
+     */
+    void previous();
+    /**
+     * @brief Checks if the MonotoneChain object has reached the last step in MonotoneChain::steps.
+     *
+     * @return true If the MonotoneChain object has reached the last step.
+     * @return false If the MonotoneChain object has not reached the last step.
+     */
+    bool isFinished();
+    /**
+     * @brief Gets the Number Of Steps in the convex hull computation.
+     *
+     * @return int number of steps.
+     */
+    int getNumberOfSteps();
+    /**
+     * @brief Gets the Current Step that is being drawn.
+     *
+     * @return int The current step.
+     */
+    int getCurrentStep();
+    /**
+     * @brief Sets the current step to the specified value.
+     *
+     * @param step The value to set the current step to.
+     */
+    void setCurrentStep(int step);
+    /**
+     * @brief Shows the legend for the visualization of the MonotoneChain computation.
+     *
+     * @param showLegend The variable used to indicate if the legend is to be displayed.
+     * @param windowPosition The position of the legend window on the screen.
+     * @param windowSize The size of the legend window.
+     * @param maxWindowSize The size of the legend window in the maximized state.
+     * @param contentSize The size of the content window inside the legend window.
+     * @param scroll The object used to keep track of current position after scrolling.
+     * @param moving The variable used to indicate if the floating window is moving.
+     * @param resizing The variable used to indicate if the floating window is resizing.
+     * @param minimized The variable used to indicate if the floating window is minimized.
+     * @param toolbarHeight The height of the toolbar.
+     * @param bottomBarHeight The height of the bottomBar.
+     * @param title The title for the floating window.
+     */
+    void showLegend(bool *showLegend, Vector2 *windowPosition, Vector2 *windowSize, Vector2 *maxWindowSize,
+                    Vector2 *contentSize, Vector2 *scroll, bool *moving, bool *resizing, bool *minimized,
+                    float toolbarHeight, float bottomBarHeight, const char *title);
+    /**
+     * @brief Gets all the points on the final convex hull.
+     *
+     * @return std::vector<Vector2> All the points on the convex hull.
+     */
+    std::vector<Vector2> exportHull();
+
+  private:
+    /**
+     * @brief Draws a chain as it was at a step, walking down from its top node.
+     *
+     * @param nodes The nodes of the chain.
+     * @param top The index of the top node of the chain, -1 if it is empty.
+     */
+    void drawChain(const std::vector<ChainNode> &nodes, int top);
+
+    /**
+     * @brief The current step in the visualization process.
+     *
+     */
+    int currentStep = 0;
+};
+
+#endif // MONOTONE_CHAIN_H
\ No newline at end of file
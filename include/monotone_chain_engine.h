@@ -0,0 +1,209 @@
+/**
+ * @file monotone_chain_engine.h
+ * @brief Contains the declaration of the MonotoneChainEngine class template.
+ *
+ * This class implements the computation of Andrew's monotone chain algorithm without any drawing, so that it can be
+ * used both by the visualizer and by headless programs.
+ *
+ */
+#ifndef MONOTONE_CHAIN_ENGINE_H
+#define MONOTONE_CHAIN_ENGINE_H
+
+#include "raylib.h"
+#include "step_recording.h"
+#include "task_scheduler.h"
+#include <vector>
+
+/**
+ * @brief Represents the MonotoneChainEngine class, implementing Andrew's monotone chain algorithm for computing the
+ * convex hull of a set of points.
+ *
+ * The points are sorted by x co-ordinate, then both chains of the hull are built in one pass over the sorted points,
+ * each one a stack from which the points that would make it turn the wrong way are popped. The sort is skipped when
+ * the points are already sorted, and otherwise is a merge sort whose halves are sorted in parallel on the
+ * TaskScheduler, so the algorithm is O(n log n), and O(n) for sorted input.
+ *
+ * Points that lie on an edge of the hull are not part of it, and duplicate points are only taken once.
+ *
+ * Usage:
+ * 1. Create an instance of the MonotoneChainEngine class with the points to be used to compute the convex hull. The
+ * convex hull is computed in the constructor.
+ * 2. Call the getConvexHull() method to get the points on the convex hull.
+ *
+ * @tparam Recording The step recording policy, Record to record the steps for the visualizer or NoRecord to skip them.
+ */
+template <typename Recording> class MonotoneChainEngine
+{
+  public:
+    /**
+     * @brief Represents the kind of a step in the algorithm.
+     *
+     */
+    enum StepType
+    {
+        SORT,
+        POP_UPPER,
+        PUSH_UPPER,
+        POP_LOWER,
+        PUSH_LOWER,
+        FINISH
+    };
+
+    /**
+     * @brief Ranges with fewer points than this are sorted serially by default.
+     *
+     */
+    static const int DEFAULT_GRAIN_SIZE = 1 << 15;
+
+    /**
+     * @brief Constructs a new Monotone Chain Engine object and computes the convex hull.
+     *
+     * @param p Set of input points.
+     * @param grainSize Ranges with fewer points than this are sorted serially instead of being split between the
+     * workers of the shared TaskScheduler.
+     */
+    MonotoneChainEngine(std::vector<Vector2> p, int grainSize = DEFAULT_GRAIN_SIZE);
+    /**
+     * @brief Gets all the points on the final convex hull.
+     *
+     * @return const std::vector<Vector2>& All the points on the convex hull, the upper chain from left to right
+     * followed by the lower chain from right to left.
+     */
+    const std::vector<Vector2> &getConvexHull() const;
+    /**
+     * @brief Tells whether the points were already sorted, so that the sort was skipped.
+     *
+     * @return true If the points were already sorted.
+     * @return false otherwise.
+     */
+    bool wasSorted() const;
+    /**
+     * @brief Comparator function for Vector2. A vector is defined as smaller than another if it has a smaller X
+     * coordinate. For equal X coordinates, the one with the smaller Y coordinate is considered smaller.
+     *
+     * @param a The first Vector2 operand.
+     * @param b The second Vector2 operand.
+     * @return true if (a < b).
+     * @return false otherwise.
+     */
+    static bool compareVector2(Vector2 a, Vector2 b);
+
+  protected:
+    /**
+     * @brief Represents a point pushed onto one of the chains. The nodes of a chain are never removed, so the chain at
+     * any step can be walked down from its top node at that step.
+     *
+     */
+    struct ChainNode
+    {
+        /**
+         * @brief The index of the point in MonotoneChainEngine::sorted.
+         *
+         */
+        int pointIndex;
+        /**
+         * @brief The index of the node below this one in the chain, -1 for the bottom of the chain.
+         *
+         */
+        int below;
+    };
+    /**
+     * @brief Represents information about a step in the monotone chain algorithm.
+     *
+     */
+    struct MonotoneChainStep
+    {
+        /**
+         * @brief The kind of the step.
+         *
+         */
+        StepType type;
+        /**
+         * @brief The index in MonotoneChainEngine::sorted of the point being added to the chains, -1 if there is none.
+         *
+         */
+        int pointIndex;
+        /**
+         * @brief The index in MonotoneChainEngine::upperNodes of the top of the upper chain, -1 if it is empty.
+         *
+         */
+        int upperTop;
+        /**
+         * @brief The index in MonotoneChainEngine::lowerNodes of the top of the lower chain, -1 if it is empty.
+         *
+         */
+        int lowerTop;
+    };
+
+    /**
+     * @brief Sorts a range of points with a merge sort whose halves are sorted in parallel.
+     *
+     * @param begin The first point of the range.
+     * @param end One past the last point of the range.
+     * @param buffer Room for as many points as the range, used to merge the halves.
+     */
+    void parallelSort(Vector2 *begin, Vector2 *end, Vector2 *buffer);
+    /**
+     * @brief Computes the cross product of the vectors from o to a and from o to b, positive when o, a and b turn
+     * counter-clockwise with y pointing up.
+     *
+     * @param o The common origin.
+     * @param a The end of the first vector.
+     * @param b The end of the second vector.
+     * @return float The cross product.
+     */
+    static float cross(Vector2 o, Vector2 a, Vector2 b);
+    /**
+     * @brief Computes the convex hull, recording all the steps in the process if the policy asks for it.
+     *
+     */
+    void computeConvexHull();
+
+    /**
+     * @brief The collection of points to be used to compute the convex hull.
+     *
+     */
+    std::vector<Vector2> points;
+    /**
+     * @brief The points sorted with MonotoneChainEngine::compareVector2, without duplicates.
+     *
+     */
+    std::vector<Vector2> sorted;
+    /**
+     * @brief The calculated convex hull.
+     *
+     */
+    std::vector<Vector2> hull;
+    /**
+     * @brief Whether the points were already sorted.
+     *
+     */
+    bool inputSorted = false;
+    /**
+     * @brief Every node pushed onto the upper chain, only filled when recording.
+     *
+     */
+    std::vector<ChainNode> upperNodes;
+    /**
+     * @brief Every node pushed onto the lower chain, only filled when recording.
+     *
+     */
+    std::vector<ChainNode> lowerNodes;
+    /**
+     * @brief Holds the steps in the computation of the convex hull, only filled when recording.
+     *
+     */
+    std::vector<MonotoneChainStep> steps;
+    /**
+     * @brief Ranges with fewer points than this are sorted serially.
+     *
+     */
+    int grainSize;
+    /**
+     * @brief The scheduler that runs the parallel sort.
+     *
+     */
+    TaskScheduler *scheduler = nullptr;
+};
+
+#endif // MONOTONE_CHAIN_ENGINE_H
\ No newline at end of file
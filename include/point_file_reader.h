@@ -0,0 +1,336 @@
+/**
+ * @file point_file_reader.h
+ * @brief Contains the declaration of the PointFileReader class.
+ *
+ * This class reads the points of a file in the "(x, y)" format, one point per line, used by the files dropped on the
+ * settings window and by the profiling programs.
+ *
+ */
+#ifndef POINT_FILE_READER_H
+#define POINT_FILE_READER_H
+
+#include "binary_point_file.h"
+#include "mapped_file.h"
+#include "raylib.h"
+#include <atomic>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Represents the PointFileReader class, parsing the points of a file in place.
+ *
+ * The file is mapped into memory rather than read through a stream, and the co-ordinates are parsed straight from the
+ * mapping with std::from_chars, which ignores the locale and makes no virtual calls, into a buffer given by the
+ * caller. readAll() cuts the text into chunks spread over the workers of the shared TaskScheduler: every chunk first
+ * counts its points, then parses them straight into its own part of the buffer, so the buffer is allocated once, the
+ * points keep the order of the file and no chunk is copied afterwards.
+ *
+ * A file that cannot be mapped, such as the standard input or any file on Windows, is held a block of
+ * PointFileReader::BLOCK_SIZE bytes at a time by read(), so that reading it in pieces takes no more memory than one
+ * block and the pieces. readAll() still reads such a file whole before parsing it.
+ *
+ * A file starting with the magic of the binary point format is read through BinaryPointFile instead, so that every
+ * reader of the text format takes binary files as well.
+ *
+ * A point is an opening parenthesis, the x co-ordinate, a comma, the y co-ordinate and a closing parenthesis, with
+ * any white space between them. When the file does not follow the format, reading stops and getError() tells the
+ * line where it went wrong.
+ *
+ * A read can be followed and cancelled from another thread through getBytesRead(), getPointsRead() and cancel().
+ *
+ * Usage:
+ * 1. Create an instance of the PointFileReader class and call open() with the path of the file.
+ * 2. Call readAll() to get all the points at once, or read() repeatedly to get them a buffer at a time.
+ * 3. Call getError() if either of them fails.
+ *
+ */
+class PointFileReader
+{
+  public:
+    /**
+     * @brief The number of bytes of text parsed by one task of readAll().
+     *
+     */
+    static const int CHUNK_SIZE = 1 << 22;
+    /**
+     * @brief The number of bytes of a file that cannot be mapped read at a time by read().
+     *
+     */
+    static const int BLOCK_SIZE = 1 << 20;
+
+    /**
+     * @brief Constructs a new Point File Reader object with no file open.
+     *
+     */
+    PointFileReader();
+    /**
+     * @brief Destroys the Point File Reader object.
+     *
+     */
+    ~PointFileReader();
+
+    /**
+     * @brief Opens a file, closing the one open before.
+     *
+     * @param filePath The path to the file.
+     * @return true If the file could be opened.
+     * @return false otherwise.
+     */
+    bool open(const std::string &filePath);
+    /**
+     * @brief Closes the file.
+     *
+     */
+    void close();
+    /**
+     * @brief Reads the next points of the file.
+     *
+     * @param out Room for capacity points, set to the points read.
+     * @param capacity The largest number of points to read.
+     * @return int The number of points read, fewer than capacity only at the end of the file or where the file does
+     * not follow the format, in which case getError() tells why.
+     */
+    int read(Vector2 *out, int capacity);
+    /**
+     * @brief Reads all the points left in the file.
+     *
+     * @param points The vector the points are appended to.
+     * @return true If the rest of the file was read.
+     * @return false If the file does not follow the format, the points before the error being appended.
+     */
+    bool readAll(std::vector<Vector2> &points);
+    /**
+     * @brief Checks whether all the points of the file have been read.
+     *
+     * @return true If only white space is left.
+     * @return false otherwise.
+     */
+    bool isAtEnd();
+    /**
+     * @brief Makes the read in progress, and any later one, stop as soon as possible and fail. Can be called from any
+     * thread.
+     *
+     */
+    void cancel();
+    /**
+     * @brief Gets the size of the open file. Can be called from any thread.
+     *
+     * @return size_t The size of the file in bytes, 0 until the end of a file that cannot be mapped has been read.
+     */
+    size_t getSize() const;
+    /**
+     * @brief Gets how much of the file has been read so far. Can be called from any thread.
+     *
+     * @return size_t The number of bytes read.
+     */
+    size_t getBytesRead() const;
+    /**
+     * @brief Gets how many points have been read so far. Can be called from any thread.
+     *
+     * @return long long The number of points read.
+     */
+    long long getPointsRead() const;
+    /**
+     * @brief Gets the open binary point file, so that its co-ordinates can be used straight from the mapping and its
+     * precomputed hull, if any, without reading the points.
+     *
+     * @return const BinaryPointFile* The binary point file, or nullptr if the open file is a text file.
+     */
+    const BinaryPointFile *getBinaryFile() const;
+    /**
+     * @brief Gets what went wrong in the last call to open(), read() or readAll().
+     *
+     * @return const std::string& The path, the line number and the reason, empty if nothing went wrong.
+     */
+    const std::string &getError() const;
+
+  private:
+    /**
+     * @brief Represents a position in the text of the file, so that pieces of it can be parsed at the same time.
+     *
+     */
+    struct TextCursor
+    {
+        /**
+         * @brief The next character to parse.
+         *
+         */
+        const char *position;
+        /**
+         * @brief The end of the text to parse.
+         *
+         */
+        const char *end;
+        /**
+         * @brief The line of the next character, from 1.
+         *
+         */
+        long long line;
+    };
+    /**
+     * @brief Represents a piece of the text parsed by one task of readAll().
+     *
+     */
+    struct TextChunk
+    {
+        /**
+         * @brief The first character of the piece.
+         *
+         */
+        const char *begin;
+        /**
+         * @brief The end of the piece.
+         *
+         */
+        const char *end;
+        /**
+         * @brief The number of opening parentheses in the piece, which is its number of points if it is valid.
+         *
+         */
+        int pointCount = 0;
+        /**
+         * @brief The number of line breaks in the piece.
+         *
+         */
+        int lineCount = 0;
+        /**
+         * @brief The index of the first point of the piece in the vector read into.
+         *
+         */
+        size_t firstPoint = 0;
+        /**
+         * @brief The line the piece starts on.
+         *
+         */
+        long long firstLine = 1;
+        /**
+         * @brief The number of points parsed from the piece.
+         *
+         */
+        int parsedCount = 0;
+        /**
+         * @brief What went wrong in the piece, empty if nothing did.
+         *
+         */
+        std::string error;
+    };
+
+    /**
+     * @brief Skips white space, counting the lines.
+     *
+     * @param text The cursor, moved past the white space.
+     */
+    static void skipSpace(TextCursor &text);
+    /**
+     * @brief Parses a co-ordinate at a cursor.
+     *
+     * @param text The cursor, moved past the co-ordinate.
+     * @param value Set to the co-ordinate.
+     * @return true If there was a co-ordinate.
+     * @return false otherwise.
+     */
+    static bool parseNumber(TextCursor &text, float &value);
+    /**
+     * @brief Parses a point at a cursor.
+     *
+     * @param text The cursor, moved past the point.
+     * @param p Set to the point.
+     * @param message Set to what went wrong if there was no point.
+     * @return true If there was a point.
+     * @return false otherwise.
+     */
+    bool parsePoint(TextCursor &text, Vector2 &p, std::string &message) const;
+    /**
+     * @brief Parses points at a cursor until the end of its text, an error or enough points.
+     *
+     * @param text The cursor, moved past the points.
+     * @param out Room for capacity points, set to the points parsed.
+     * @param capacity The largest number of points to parse.
+     * @param message Set to what went wrong if there was an error.
+     * @return int The number of points parsed.
+     */
+    int parseText(TextCursor &text, Vector2 *out, int capacity, std::string &message) const;
+    /**
+     * @brief Describes something missing at a cursor.
+     *
+     * @param text The cursor.
+     * @param expected What was expected.
+     * @param message Set to the path, the line, what was expected and what was found instead.
+     * @return false always.
+     */
+    bool fail(const TextCursor &text, const char *expected, std::string &message) const;
+    /**
+     * @brief Points the cursor into the text held after it was read or moved, noting the size of the file once its
+     * end is held.
+     *
+     * @param offset The offset in the text held of the next character to parse.
+     */
+    void moveCursor(size_t offset);
+    /**
+     * @brief Reads all the points left in a text file, cutting the text into chunks parsed on the workers of the
+     * shared TaskScheduler.
+     *
+     * @param points The vector the points are appended to.
+     * @return true If the rest of the file was read.
+     * @return false otherwise.
+     */
+    bool readAllText(std::vector<Vector2> &points);
+
+    /**
+     * @brief The path of the open file.
+     *
+     */
+    std::string path;
+    /**
+     * @brief The mapped text file.
+     *
+     */
+    MappedFile file;
+    /**
+     * @brief The binary file, used instead of PointFileReader::file when PointFileReader::binary is set.
+     *
+     */
+    BinaryPointFile binaryFile;
+    /**
+     * @brief Whether the open file is a binary point file.
+     *
+     */
+    bool binary = false;
+    /**
+     * @brief The index of the next point to read from a binary file.
+     *
+     */
+    long long nextPoint = 0;
+    /**
+     * @brief The next character to parse in a text file, whose end is the end of the text held.
+     *
+     */
+    TextCursor cursor = {nullptr, nullptr, 1};
+    /**
+     * @brief What went wrong in the last call, empty if nothing did.
+     *
+     */
+    std::string error;
+    /**
+     * @brief The size of the file in bytes, 0 while it is not known.
+     *
+     */
+    std::atomic<size_t> size{0};
+    /**
+     * @brief The number of bytes of the file read so far.
+     *
+     */
+    std::atomic<size_t> bytesRead{0};
+    /**
+     * @brief The number of points read so far.
+     *
+     */
+    std::atomic<long long> pointsRead{0};
+    /**
+     * @brief Whether cancel() has been called.
+     *
+     */
+    std::atomic<bool> cancelled{false};
+};
+
+#endif // POINT_FILE_READER_H
\ No newline at end of file
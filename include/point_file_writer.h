@@ -0,0 +1,182 @@
+/**
+ * @file point_file_writer.h
+ * @brief Contains the declaration of the PointFileWriter class.
+ *
+ * This class writes points in the "(x, y)" format read by PointFileReader, or as CSV, used to export the convex hull
+ * from the visualizer and by the profiling programs.
+ *
+ */
+#ifndef POINT_FILE_WRITER_H
+#define POINT_FILE_WRITER_H
+
+#include "raylib.h"
+#include <string>
+#include <vector>
+
+/**
+ * @brief Represents the PointFileWriter class, formatting points into a buffer that is written out at once.
+ *
+ * The co-ordinates are formatted with std::to_chars, which ignores the locale and makes no virtual calls, straight
+ * into a buffer grown ahead of the points, so no point builds a temporary string. The whole buffer is then handed to
+ * the system in a single write instead of a write or a flush per line.
+ *
+ * Usage:
+ * 1. Create an instance of the PointFileWriter class with the format and the precision of the co-ordinates.
+ * 2. Call addPoints() or addPoint() with the points, and addBlankLine() to separate groups of them.
+ * 3. Call save() to write the points to a file, print() to write them to the standard output, or getData() and
+ * getSize() to get the text.
+ *
+ */
+class PointFileWriter
+{
+  public:
+    /**
+     * @brief Represents the format of the points.
+     *
+     */
+    enum Format
+    {
+        TEXT,
+        CSV
+    };
+
+    /**
+     * @brief The precision writing every co-ordinate without an exponent, with the fewest digits that read back to the
+     * same value.
+     *
+     */
+    static const int SHORTEST = -1;
+
+    /**
+     * @brief Constructs a new Point File Writer object with no points.
+     *
+     * @param format TEXT for one "(x,y)" point per line, or CSV for an "x,y" header followed by one "x,y" point per
+     * line.
+     * @param precision The number of digits after the decimal point, or PointFileWriter::SHORTEST.
+     */
+    PointFileWriter(Format format = TEXT, int precision = SHORTEST);
+    /**
+     * @brief Destroys the Point File Writer object.
+     *
+     */
+    ~PointFileWriter();
+
+    /**
+     * @brief Adds a point.
+     *
+     * @param p The point.
+     */
+    void addPoint(Vector2 p);
+    /**
+     * @brief Adds points, growing the buffer once for all of them.
+     *
+     * @param points The points, in the order they are written.
+     */
+    void addPoints(const std::vector<Vector2> &points);
+    /**
+     * @brief Adds an empty line, separating the points added before from the points added after.
+     *
+     */
+    void addBlankLine();
+    /**
+     * @brief Removes all the points, keeping the memory of the buffer.
+     *
+     */
+    void clear();
+    /**
+     * @brief Gets the text of the points.
+     *
+     * @return const char* The first character of the text, which is not null terminated.
+     */
+    const char *getData() const;
+    /**
+     * @brief Gets the length of the text of the points.
+     *
+     * @return size_t The number of characters.
+     */
+    size_t getSize() const;
+    /**
+     * @brief Writes the text of the points to a file, replacing it.
+     *
+     * @param filePath The path to the file.
+     * @return true If the whole text was written.
+     * @return false otherwise, in which case getError() tells why.
+     */
+    bool save(const std::string &filePath);
+    /**
+     * @brief Writes the text of the points to the standard output.
+     *
+     * @return true If the whole text was written.
+     * @return false otherwise, in which case getError() tells why.
+     */
+    bool print();
+    /**
+     * @brief Gets what went wrong in the last call to save() or print().
+     *
+     * @return const std::string& The path and the reason, empty if nothing went wrong.
+     */
+    const std::string &getError() const;
+
+  private:
+#if !defined(_WIN32)
+    /**
+     * @brief Writes the text of the points to an open file.
+     *
+     * @param descriptor The open file.
+     * @return true If the whole text was written.
+     * @return false otherwise.
+     */
+    bool writeAll(int descriptor) const;
+#endif
+    /**
+     * @brief Makes room at the end of the buffer.
+     *
+     * @param length The number of characters to make room for.
+     */
+    void reserve(size_t length);
+    /**
+     * @brief Formats a co-ordinate at the end of the text, where there must be room for it.
+     *
+     * @param value The co-ordinate.
+     */
+    void appendNumber(float value);
+    /**
+     * @brief Formats a point at the end of the text, where there must be room for it.
+     *
+     * @param p The point.
+     */
+    void appendPoint(Vector2 p);
+
+    /**
+     * @brief The format of the points.
+     *
+     */
+    Format format;
+    /**
+     * @brief The number of digits after the decimal point, or PointFileWriter::SHORTEST.
+     *
+     */
+    int precision;
+    /**
+     * @brief The most characters a point can take, line break included.
+     *
+     */
+    size_t pointLength;
+    /**
+     * @brief The buffer holding the text, longer than the text itself.
+     *
+     */
+    std::vector<char> buffer;
+    /**
+     * @brief The length of the text at the start of PointFileWriter::buffer.
+     *
+     */
+    size_t size = 0;
+    /**
+     * @brief What went wrong in the last call to save() or print(), empty if nothing did.
+     *
+     */
+    std::string error;
+};
+
+#endif // POINT_FILE_WRITER_H
\ No newline at end of file
@@ -0,0 +1,125 @@
+/**
+ * @file quick_hull.h
+ * @brief Contains the declaration of the QuickHull class.
+ *
+ * This class implements the QuickHull algorithm to compute the convex hull of a set of points.
+ *
+ */
+#ifndef QUICK_HULL_H
+#define QUICK_HULL_H
+
+#include "quick_hull_engine.h"
+#include "convex_hull.h"
+
+/**
+ * @brief Represents the QuickHull class, implementing the QuickHull algorithm for computing the convex hull of a set of
+ * points.
+ *
+ * The computation itself is done by QuickHullEngine, with every step recorded and the points on the edges of the hull
+ * kept, while this class draws the recorded steps: every split line with the points outside it, the point furthest from
+ * it, and the edges of the hull found so far.
+ *
+ * Usage:
+ * 1. Create an instance of the QuickHull class with the points to be used to compute the convex hull. The convex hull
+ * is computed in the constructor.
+ * 2. Call the next() or previous() method to get the next or previous step in the convex hull computation process.
+ * 3. Call the draw() method to draw the current step of the convex hull computation process.
+ *
+ */
+class QuickHull : public ConvexHullAlgorithm, private QuickHullEngine<Record>
+{
+  public:
+    /**
+     * @brief Constructs a new QuickHull object.
+     *
+     * @param p Set of input points.
+     */
+    QuickHull(std::vector<Vector2> p);
+    /**
+     * @brief Destroys the QuickHull object.
+     *
+     */
+    ~QuickHull();
+
+    /**
+     * @brief Draws the QuickHull::currentStep of the QuickHull object.
+     *
+     */
+    void draw();
+    /**
+     * @brief Gets the next step of the QuickHull object.
+     *
+     */
+    void next();
+    /**
+     * @brief Gets the previous step of the QuickHull object.
+     *
+     */
+    void previous();
+    /**
+     * @brief Checks if the QuickHull object has reached the last step in QuickHull::steps.
+     *
+     * @return true If the QuickHull object has reached the last step.
+     * @return false If the QuickHull object has not reached the last step.
+     */
+    bool isFinished();
+    /**
+     * @brief Gets the Number Of Steps in the convex hull computation.
+     *
+     * @return int number of steps.
+     */
+    int getNumberOfSteps();
+    /**
+     * @brief Gets the Current Step that is being drawn.
+     *
+     * @return int The current step.
+     */
+    int getCurrentStep();
+    /**
+     * @brief Sets the current step to the specified value.
+     *
+     * @param step The value to set the current step to.
+     */
+    void setCurrentStep(int step);
+    /**
+     * @brief Shows the legend for the visualization of the QuickHull computation.
+     *
+     * @param showLegend The variable used to indicate if the legend is to be displayed.
+     * @param windowPosition The position of the legend window on the screen.
+     * @param windowSize The size of the legend window.
+     * @param maxWindowSize The size of the legend window in the maximized state.
+     * @param contentSize The size of the content window inside the legend window.
+     * @param scroll The object used to keep track of current position after scrolling.
+     * @param moving The variable used to indicate if the floating window is moving.
+     * @param resizing The variable used to indicate if the floating window is resizing.
+     * @param minimized The variable used to indicate if the floating window is minimized.
+     * @param toolbarHeight The height of the toolbar.
+     * @param bottomBarHeight The height of the bottomBar.
+     * @param title The title for the floating window.
+     */
+    void showLegend(bool *showLegend, Vector2 *windowPosition, Vector2 *windowSize, Vector2 *maxWindowSize,
+                    Vector2 *contentSize, Vector2 *scroll, bool *moving, bool *resizing, bool *minimized,
+                    float toolbarHeight, float bottomBarHeight, const char *title);
+    /**
+     * @brief Gets all the points on the final convex hull.
+     *
+     * @return std::vector<Vector2> All the points on the convex hull.
+     */
+    std::vector<Vector2> exportHull();
+
+  private:
+    /**
+     * @brief Draws the edges of the hull found so far.
+     *
+     * @param edgeCount The number of edges of QuickHullEngine::edges to draw.
+     */
+    void drawEdges(int edgeCount);
+
+    /**
+     * @brief The current step in the visualization process.
+     *
+     */
+    int currentStep = 0;
+};
+
+#endif // QUICK_HULL_H
\ No newline at end of file
@@ -0,0 +1,215 @@
+/**
+ * @file quick_hull_engine.h
+ * @brief Contains the declaration of the QuickHullEngine class template.
+ *
+ * This class implements the computation of the QuickHull algorithm without any drawing, so that it can be used both by
+ * the visualizer and by headless programs.
+ *
+ */
+#ifndef QUICK_HULL_ENGINE_H
+#define QUICK_HULL_ENGINE_H
+
+#include "raylib.h"
+#include "step_recording.h"
+#include "task_scheduler.h"
+#include <vector>
+
+/**
+ * @brief Represents the QuickHullEngine class, implementing the QuickHull algorithm for computing the convex hull of a
+ * set of points.
+ *
+ * The points are split by the line through the left most and right most points. On each side, the point furthest
+ * from the split line is on the hull, and the points inside the triangle it forms with the line are dropped, while
+ * the rest are split in the same way by the two new sides of the triangle. Every range is partitioned in place into
+ * the points outside each new side, and the two halves are computed in parallel on the TaskScheduler.
+ *
+ * By default only the corners of the hull are kept. When asked to, the points lying on an edge of the hull are kept
+ * too, like KirkpatrickSeidelEngine does, except that they are kept on every edge: KirkpatrickSeidelEngine drops the
+ * inner points of a vertical edge at the largest x co-ordinate, and starts from another point of the hull.
+ *
+ * Usage:
+ * 1. Create an instance of the QuickHullEngine class with the points to be used to compute the convex hull. The convex
+ * hull is computed in the constructor.
+ * 2. Call the getConvexHull() method to get the points on the convex hull.
+ *
+ * @tparam Recording The step recording policy, Record to record the steps for the visualizer or NoRecord to skip them.
+ */
+template <typename Recording> class QuickHullEngine
+{
+  public:
+    /**
+     * @brief Represents the kind of a step in the algorithm.
+     *
+     */
+    enum StepType
+    {
+        SPLIT,
+        FURTHEST,
+        EDGE,
+        FINISH
+    };
+
+    /**
+     * @brief Ranges with fewer points than this are not split between the workers of the TaskScheduler by default.
+     *
+     */
+    static const int DEFAULT_GRAIN_SIZE = 1 << 14;
+
+    /**
+     * @brief Constructs a new Quick Hull Engine object and computes the convex hull.
+     *
+     * @param p Set of input points.
+     * @param keepCollinear Whether the points lying on an edge of the hull are part of it, on every edge including a
+     * vertical one at the largest x co-ordinate.
+     * @param grainSize Ranges with fewer points than this are computed serially instead of being split between the
+     * workers of the shared TaskScheduler.
+     */
+    QuickHullEngine(std::vector<Vector2> p, bool keepCollinear = false, int grainSize = DEFAULT_GRAIN_SIZE);
+    /**
+     * @brief Gets all the points on the final convex hull.
+     *
+     * @return const std::vector<Vector2>& All the points on the convex hull, in clockwise order with y pointing up from
+     * the point with the smallest x and y co-ordinates.
+     */
+    const std::vector<Vector2> &getConvexHull() const;
+    /**
+     * @brief Comparator function for Vector2. A vector is defined as smaller than another if it has a smaller X
+     * coordinate. For equal X coordinates, the one with the smaller Y coordinate is considered smaller.
+     *
+     * @param a The first Vector2 operand.
+     * @param b The second Vector2 operand.
+     * @return true if (a < b).
+     * @return false otherwise.
+     */
+    static bool compareVector2(Vector2 a, Vector2 b);
+
+  protected:
+    /**
+     * @brief Represents information about a step in the QuickHull algorithm.
+     *
+     */
+    struct QuickHullStep
+    {
+        /**
+         * @brief The kind of the step.
+         *
+         */
+        StepType type;
+        /**
+         * @brief The start of the split line.
+         *
+         */
+        Vector2 p;
+        /**
+         * @brief The end of the split line.
+         *
+         */
+        Vector2 q;
+        /**
+         * @brief The point furthest from the split line.
+         *
+         */
+        Vector2 furthest;
+        /**
+         * @brief The points outside the split line, or the points on it for an edge of the hull.
+         *
+         */
+        std::vector<Vector2> arr;
+        /**
+         * @brief The number of edges of QuickHullEngine::edges found so far.
+         *
+         */
+        int edgeCount;
+    };
+
+    /**
+     * @brief Computes the cross product of the vectors from o to a and from o to b, positive when o, a and b turn
+     * counter-clockwise with y pointing up.
+     *
+     * @param o The common origin.
+     * @param a The end of the first vector.
+     * @param b The end of the second vector.
+     * @return float The cross product.
+     */
+    static float cross(Vector2 o, Vector2 a, Vector2 b);
+    /**
+     * @brief Tells whether a point on the line through p and q lies strictly between them.
+     *
+     * @param p The start of the segment.
+     * @param q The end of the segment.
+     * @param v The point.
+     * @return true If the point is strictly between p and q.
+     * @return false otherwise.
+     */
+    static bool isBetween(Vector2 p, Vector2 q, Vector2 v);
+    /**
+     * @brief Calculates the part of the hull between p and q, going clockwise, for the points in the given range of
+     * QuickHullEngine::work.
+     *
+     * @param p The start of the split line.
+     * @param q The end of the split line.
+     * @param begin Index of the first point of the range, the points from there to mid being left of the line from p
+     * to q.
+     * @param mid Index of the first point of the range on the segment from p to q, only kept when keeping collinear
+     * points.
+     * @param end Index one past the last point of the range.
+     * @param out Array with room for end - begin points, to which the points of the hull strictly between p and q are
+     * written in order.
+     * @return int The number of points written.
+     */
+    int hullSide(Vector2 p, Vector2 q, int begin, int mid, int end, Vector2 *out);
+    /**
+     * @brief Computes the convex hull, recording all the steps in the process if the policy asks for it.
+     *
+     */
+    void computeConvexHull();
+
+    /**
+     * @brief The collection of points to be used to compute the convex hull.
+     *
+     */
+    std::vector<Vector2> points;
+    /**
+     * @brief The calculated convex hull.
+     *
+     */
+    std::vector<Vector2> hull;
+    /**
+     * @brief The working buffer of points that the recursion partitions in place.
+     *
+     */
+    std::vector<Vector2> work;
+    /**
+     * @brief The output buffer of the recursion, every range writing its part of the hull at the start of its own
+     * range.
+     *
+     */
+    std::vector<Vector2> output;
+    /**
+     * @brief Whether the points lying on an edge of the hull are part of it.
+     *
+     */
+    bool keepCollinear;
+    /**
+     * @brief The edges of the hull in the order they were found, only filled when recording.
+     *
+     */
+    std::vector<std::pair<Vector2, Vector2>> edges;
+    /**
+     * @brief Holds the steps in the computation of the convex hull, only filled when recording.
+     *
+     */
+    std::vector<QuickHullStep> steps;
+    /**
+     * @brief Ranges with fewer points than this are computed serially.
+     *
+     */
+    int grainSize;
+    /**
+     * @brief The scheduler that runs the parallel parts of the computation.
+     *
+     */
+    TaskScheduler *scheduler = nullptr;
+};
+
+#endif // QUICK_HULL_ENGINE_H
\ No newline at end of file
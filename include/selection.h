@@ -0,0 +1,89 @@
+/**
+ * @file selection.h
+ * @brief Contains the declaration of the Selection class.
+ *
+ * This class implements in-place order statistic selection on arrays of floats.
+ *
+ */
+#ifndef SELECTION_H
+#define SELECTION_H
+
+#include <utility>
+
+/**
+ * @brief Represents the Selection class, implementing allocation free selection of the element of a given rank.
+ *
+ * All functions work on a caller-owned scratch array which they permute in place, so no memory is allocated while
+ * selecting. Pivots are found with the median of medians method, where the medians of the groups of five are found
+ * using a sorting network, and every pass partitions the array in three (less than, equal to and greater than the
+ * pivot) so that duplicates are settled in a single pass.
+ *
+ * Usage:
+ * 1. Copy the values into a scratch array owned by the caller.
+ * 2. Call select() to get the element of a given rank, or selectPair() to get the elements of two ranks in one pass.
+ *
+ */
+class Selection
+{
+  public:
+    /**
+     * @brief Selects the element of the given rank in O(n) time, permuting the array in place.
+     *
+     * @param values The scratch array to select from.
+     * @param n The number of elements in the array.
+     * @param rank The rank of the element to be selected, starting from 1.
+     * @return float The selected element, or 0 if the rank is out of range.
+     */
+    static float select(float *values, int n, int rank);
+    /**
+     * @brief Selects the elements of two given ranks in O(n) time, sharing the partitioning passes between both of
+     * them as long as they fall on the same side of the pivot.
+     *
+     * @param values The scratch array to select from.
+     * @param n The number of elements in the array.
+     * @param firstRank The rank of the first element to be selected, starting from 1.
+     * @param secondRank The rank of the second element to be selected, starting from 1.
+     * @return std::pair<float, float> The selected elements, in the order of the given ranks.
+     */
+    static std::pair<float, float> selectPair(float *values, int n, int firstRank, int secondRank);
+    /**
+     * @brief Finds a pivot that is guaranteed to have at least 30% of the elements on either side of it.
+     *
+     * @param values The scratch array, whose first n / 5 elements are overwritten with the group medians.
+     * @param n The number of elements in the array.
+     * @return float The pivot.
+     */
+    static float medianOfMedians(float *values, int n);
+
+  private:
+    /**
+     * @brief Arrays with at most these many elements are sorted directly instead of being partitioned.
+     *
+     */
+    static const int SMALL_SIZE = 16;
+    /**
+     * @brief Sorts five consecutive elements using an optimal sorting network of nine comparators.
+     *
+     * @param values Pointer to the first of the five elements.
+     */
+    static void sortFive(float *values);
+    /**
+     * @brief Sorts a small array using insertion sort.
+     *
+     * @param values The array to be sorted.
+     * @param n The number of elements in the array.
+     */
+    static void sortSmall(float *values, int n);
+    /**
+     * @brief Partitions the array in place into elements less than, equal to and greater than the pivot.
+     *
+     * @param values The array to be partitioned.
+     * @param n The number of elements in the array.
+     * @param pivot The pivot.
+     * @param lessEnd Set to the index one past the last element less than the pivot.
+     * @param greaterBegin Set to the index of the first element greater than the pivot.
+     */
+    static void partition(float *values, int n, float pivot, int &lessEnd, int &greaterBegin);
+};
+
+#endif // SELECTION_H
\ No newline at end of file
@@ -8,9 +8,12 @@
 #ifndef SETTINGS_H
 #define SETTINGS_H
 
+#include "point_file_reader.h"
 #include "raylib.h"
 #include <fstream>
+#include <future>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -23,6 +26,9 @@
  * 3. Call the checkPointValidity() method to ensure that unwanted points are not added to the canvas when using the
  * settings window.
  *
+ * A dropped file is loaded in the background, so that the window keeps drawing its frames while a large file is read.
+ * Its points are only handed over once all of them have been read.
+ *
  */
 
 class Settings
@@ -73,6 +79,37 @@ class Settings
      *
      */
     const char *title = "Settings";
+    /**
+     * @brief Tells why the last file dropped could not be loaded, empty if it was.
+     *
+     */
+    std::string fileError;
+    /**
+     * @brief The reader of the file being loaded, null when no file is.
+     *
+     */
+    std::unique_ptr<PointFileReader> loadingReader;
+    /**
+     * @brief The points of the file being loaded, filled by the background load.
+     *
+     */
+    std::vector<Vector2> loadingPoints;
+    /**
+     * @brief The smallest x and y co-ordinates of the points of the last file loaded.
+     *
+     */
+    Vector2 loadedMin = {0, 0};
+    /**
+     * @brief The largest x and y co-ordinates of the points of the last file loaded.
+     *
+     */
+    Vector2 loadedMax = {0, 0};
+    /**
+     * @brief The background load of the dropped file, true once it has read the whole file. Declared last so that it is
+     * destroyed, and waited for, before the members it fills.
+     *
+     */
+    std::future<bool> loading;
 
     /**
      * @brief Draws the random point generation component on the screen.
@@ -85,8 +122,10 @@ class Settings
      * @param bottomBarHeight The height of the bottomBar.
      * @param numberOfPoints The number of points to be drawn during random point generation.
      * @param dataPoints The coordinates of points on which the convex hull is to be computed.
+     * @return true If the points were replaced.
+     * @return false otherwise.
      */
-    void drawRandomPointGenerationComponent(Vector2 padding, Vector2 componentPosition, Vector2 componentSize,
+    bool drawRandomPointGenerationComponent(Vector2 padding, Vector2 componentPosition, Vector2 componentSize,
                                             Vector2 *scroll, float toolbarHeight, float bottomBarHeight,
                                             float *numberOfPoints, std::vector<Vector2> &dataPoints);
     /**
@@ -117,8 +156,10 @@ class Settings
      * @param scissor The dimensions of the screen when windowSize is less than contentSize.
      * @param centerX The new X value by which points are shifted to fit on screen.
      * @param centerY The new Y value by which points are shifted to fit on screen.
+     * @return true If the points were replaced.
+     * @return false otherwise.
      */
-    void drawFileInputComponent(Vector2 padding, Vector2 componentPosition, Vector2 componentSize, Vector2 *scroll,
+    bool drawFileInputComponent(Vector2 padding, Vector2 componentPosition, Vector2 componentSize, Vector2 *scroll,
                                 bool *isFilePathAdded, std::string &filePath, std::vector<Vector2> &fileDataPoints,
                                 std::vector<Vector2> &dataPoints, float toolbarHeight, float bottomBarHeight,
                                 float *scale, Rectangle scissor, float &centerX, float &centerY);
@@ -134,15 +175,37 @@ class Settings
     void drawTimestepComponent(Vector2 padding, Vector2 componentPosition, Vector2 componentSize, Vector2 *scroll,
                                float *duration);
     /**
-     * @brief Computes the new scale for the given points from the file, so as to fit them all on
-     * screen.
+     * @brief Computes the new scale for the points from the file, so as to fit them all on screen.
+     *
+     * @param smallest The smallest x and y co-ordinates of the points.
+     * @param largest The largest x and y co-ordinates of the points.
+     * @param scale The scale using which the points are drawn on the screen.
+     * @param toolbarHeight The height of the toolbar.
+     * @param bottomBarHeight The height of the bottomBar.
+     */
+    void computeScale(Vector2 smallest, Vector2 largest, float *scale, float toolbarHeight, float bottomBarHeight);
+    /**
+     * @brief Starts loading a dropped file in the background.
      *
+     * @param path The path of the dropped file.
+     * @param isFilePathAdded The variable used to indicate if points from a file have been loaded into memory.
+     * @param filePath The filePath of the dropped file.
+     * @param fileDataPoints The coordinates of the points obtained from a file.
+     */
+    void startLoading(const char *path, bool *isFilePathAdded, std::string &filePath,
+                      std::vector<Vector2> &fileDataPoints);
+    /**
+     * @brief Hands the points over once the background load is done, or drops the file if the load failed.
+     *
+     * @param isFilePathAdded The variable used to indicate if points from a file have been loaded into memory.
+     * @param filePath The filePath of the dropped file.
      * @param fileDataPoints The coordinates of the points obtained from a file.
      * @param scale The scale using which the points are drawn on the screen.
      * @param toolbarHeight The height of the toolbar.
      * @param bottomBarHeight The height of the bottomBar.
      */
-    void computeScale(std::vector<Vector2> &fileDataPoints, float *scale, float toolbarHeight, float bottomBarHeight);
+    void pollLoading(bool *isFilePathAdded, std::string &filePath, std::vector<Vector2> &fileDataPoints, float *scale,
+                     float toolbarHeight, float bottomBarHeight);
 
   public:
     /**
@@ -174,8 +237,10 @@ class Settings
      * @param dataPoints The coordinates of points on which the convex hull is to be computed.
      * @param centerX The new X value by which points are shifted to fit on screen.
      * @param centerY The new Y value by which points are shifted to fit on screen.
+     * @return true If the points were replaced.
+     * @return false otherwise.
      */
-    void showSettings(bool *showSettings, float toolbarHeight, float bottomBarHeight, float *scale, float *duration,
+    bool showSettings(bool *showSettings, float toolbarHeight, float bottomBarHeight, float *scale, float *duration,
                       std::string &filePath, bool *isFilePathAdded, float *numberOfPoints,
                       std::vector<Vector2> &fileDataPoints, std::vector<Vector2> &dataPoints, float &centerX,
                       float &centerY);
@@ -0,0 +1,82 @@
+/**
+ * @file simd_kernels.h
+ * @brief Contains the declaration of the SimdKernels class.
+ *
+ * This class implements the data parallel loops of the Kirkpatrick-Seidel bridge search with SIMD instructions.
+ *
+ */
+#ifndef SIMD_KERNELS_H
+#define SIMD_KERNELS_H
+
+#include "raylib.h"
+#include <utility>
+
+/**
+ * @brief Represents the SimdKernels class, implementing the loops over arrays of points done in every pruning round of
+ * KirkpatrickSeidelEngine::bridge().
+ *
+ * Every kernel has an AVX2, an SSE4.1 and a scalar version. The version to use is picked once, the first time a kernel
+ * is called, from the features of the CPU that runs the program, so the same binary runs on every x86 host. On other
+ * platforms, and on the web, only the scalar versions are built.
+ *
+ * All versions give bit for bit the same results: they do the same floating point operations, with no fused multiply
+ * adds, and the vector versions of supportingPoints() hand every group of points that could change the result to the
+ * scalar version, so the points are still visited in order.
+ *
+ */
+class SimdKernels
+{
+  public:
+    /**
+     * @brief Calculates the slope of every pair made of points[i] and points[n - 1 - i], for i < n / 2, taking the
+     * difference from the point with the smaller x to the other one.
+     *
+     * @param points The points.
+     * @param n The number of points.
+     * @param slopes Array with room for n / 2 slopes. The slope of a vertical pair is left as an infinity or NaN.
+     * @param ySign 1, or -1 to work on the points mirrored about the x axis.
+     * @return int The number of vertical pairs.
+     */
+    static int pairSlopes(const Vector2 *points, int n, float *slopes, float ySign);
+    /**
+     * @brief Finds the leftmost and the rightmost of the points whose intercept y - slope * x is tied with the largest
+     * intercept, meaning it is within tolerance() of it.
+     *
+     * The points are visited in order while keeping a running maximum, which only moves to a new intercept larger than
+     * it by more than the tolerance, and the ties are measured from that running maximum. The vector versions only
+     * skip runs of points that are all too far below it to change anything.
+     *
+     * @param points The points.
+     * @param n The number of points, at least 1.
+     * @param slope The slope.
+     * @param ySign 1, or -1 to work on the points mirrored about the x axis.
+     * @return std::pair<int, int> The index of the leftmost and the index of the rightmost tied point, taking the
+     * first one when several of them share the same x co-ordinate.
+     */
+    static std::pair<int, int> supportingPoints(const Vector2 *points, int n, float slope, float ySign);
+    /**
+     * @brief Calculates the error threshold for comparing two intercepts, which grows with their magnitude.
+     *
+     * @param a The first intercept.
+     * @param b The second intercept.
+     * @return float The threshold.
+     */
+    static float tolerance(float a, float b);
+    /**
+     * @brief Gets the name of the instruction set the kernels run with on this CPU.
+     *
+     * @return const char* "avx2", "sse4.1" or "scalar".
+     */
+    static const char *getInstructionSet();
+    /**
+     * @brief Makes the kernels run with the given instruction set, so that the versions can be compared with each
+     * other. It must not be called while a kernel is running.
+     *
+     * @param name "avx2", "sse4.1" or "scalar".
+     * @return true If this CPU supports the instruction set.
+     * @return false otherwise, in which case the kernels are left unchanged.
+     */
+    static bool useInstructionSet(const char *name);
+};
+
+#endif // SIMD_KERNELS_H
\ No newline at end of file
@@ -0,0 +1,159 @@
+/**
+ * @file step_generator.h
+ * @brief Contains the declaration of the StepGenerator class template.
+ *
+ * This class is the return type of the coroutines that produce the steps of a convex hull algorithm one at a time.
+ *
+ */
+#ifndef STEP_GENERATOR_H
+#define STEP_GENERATOR_H
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+/**
+ * @brief Represents the StepGenerator class template, a coroutine that yields the steps of an algorithm lazily.
+ *
+ * The coroutine starts suspended and only runs up to its next `co_yield` when next() is called, so a step is computed
+ * only once it is asked for.
+ *
+ * Usage:
+ * 1. Write a coroutine returning StepGenerator<Step> that does `co_yield` for every step.
+ * 2. Call next() to run the coroutine up to its next step, until it returns false.
+ * 3. Call current() to get the step it stopped at.
+ *
+ * @tparam Step The type of the steps.
+ */
+template <typename Step> class StepGenerator
+{
+  public:
+    /**
+     * @brief The promise type of the coroutine, holding the last yielded step.
+     *
+     */
+    struct promise_type
+    {
+        /**
+         * @brief The last yielded step.
+         *
+         */
+        std::optional<Step> step;
+        /**
+         * @brief The exception thrown by the coroutine, if any.
+         *
+         */
+        std::exception_ptr error;
+
+        StepGenerator get_return_object()
+        {
+            return StepGenerator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+        std::suspend_always final_suspend() noexcept
+        {
+            return {};
+        }
+        std::suspend_always yield_value(Step value)
+        {
+            step = std::move(value);
+            return {};
+        }
+        void return_void()
+        {
+        }
+        void unhandled_exception()
+        {
+            error = std::current_exception();
+        }
+    };
+
+    /**
+     * @brief Constructs an empty Step Generator object, that yields no steps.
+     *
+     */
+    StepGenerator() = default;
+    /**
+     * @brief Constructs a new Step Generator object taking over the coroutine of another one.
+     *
+     * @param other The generator to take the coroutine from.
+     */
+    StepGenerator(StepGenerator &&other) noexcept : handle(std::exchange(other.handle, nullptr))
+    {
+    }
+    /**
+     * @brief Destroys the coroutine of this generator and takes over the coroutine of another one.
+     *
+     * @param other The generator to take the coroutine from.
+     * @return StepGenerator& This generator.
+     */
+    StepGenerator &operator=(StepGenerator &&other) noexcept
+    {
+        if (this != &other)
+        {
+            if (handle)
+                handle.destroy();
+            handle = std::exchange(other.handle, nullptr);
+        }
+        return *this;
+    }
+    StepGenerator(const StepGenerator &) = delete;
+    StepGenerator &operator=(const StepGenerator &) = delete;
+    /**
+     * @brief Destroys the Step Generator object along with its coroutine.
+     *
+     */
+    ~StepGenerator()
+    {
+        if (handle)
+            handle.destroy();
+    }
+
+    /**
+     * @brief Runs the coroutine up to its next step.
+     *
+     * @return true If the coroutine yielded a step.
+     * @return false If the coroutine has finished.
+     */
+    bool next()
+    {
+        if (!handle || handle.done())
+            return false;
+        handle.promise().step.reset();
+        handle.resume();
+        if (handle.promise().error)
+            std::rethrow_exception(std::exchange(handle.promise().error, nullptr));
+        return handle.promise().step.has_value();
+    }
+    /**
+     * @brief Gets the step the coroutine stopped at. Only valid after next() has returned true.
+     *
+     * @return const Step& The step.
+     */
+    const Step &current() const
+    {
+        return *handle.promise().step;
+    }
+
+  private:
+    /**
+     * @brief Constructs a new Step Generator object owning the given coroutine.
+     *
+     * @param handle The coroutine.
+     */
+    explicit StepGenerator(std::coroutine_handle<promise_type> handle) : handle(handle)
+    {
+    }
+
+    /**
+     * @brief The coroutine, or nullptr if the generator is empty.
+     *
+     */
+    std::coroutine_handle<promise_type> handle = nullptr;
+};
+
+#endif // STEP_GENERATOR_H
\ No newline at end of file
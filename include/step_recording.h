@@ -0,0 +1,38 @@
+/**
+ * @file step_recording.h
+ * @brief Contains the declaration of the step recording policies used by the convex hull engines.
+ *
+ * The engines are class templates taking one of these policies. Every place that records a step for the visualizer
+ * is guarded by `if constexpr (Recording::enabled)`, so with NoRecord the step code compiles out to nothing.
+ *
+ */
+#ifndef STEP_RECORDING_H
+#define STEP_RECORDING_H
+
+/**
+ * @brief Step recording policy that records every step, used to drive the visualizer.
+ *
+ */
+struct Record
+{
+    /**
+     * @brief Indicates that steps are recorded.
+     *
+     */
+    static constexpr bool enabled = true;
+};
+
+/**
+ * @brief Step recording policy that records nothing, used for headless runs where only the hull is needed.
+ *
+ */
+struct NoRecord
+{
+    /**
+     * @brief Indicates that steps are not recorded.
+     *
+     */
+    static constexpr bool enabled = false;
+};
+
+#endif // STEP_RECORDING_H
\ No newline at end of file
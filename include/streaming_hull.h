@@ -0,0 +1,121 @@
+/**
+ * @file streaming_hull.h
+ * @brief Contains the declaration of the StreamingHull class.
+ *
+ * This class computes the convex hull of a stream of points too large to be held in memory at once.
+ *
+ */
+#ifndef STREAMING_HULL_H
+#define STREAMING_HULL_H
+
+#include "raylib.h"
+#include <string>
+#include <vector>
+
+/**
+ * @brief Represents the StreamingHull class, computing the convex hull of points that arrive one at a time, such as
+ * the points read from a file larger than the memory.
+ *
+ * The points are gathered into a chunk of fixed size. Once the chunk is full, the points that cannot be on its hull
+ * are discarded with HullPrefilter, the hull found so far is added to the rest, and their hull, computed with
+ * MonotoneChainEngine, becomes the new hull found so far. The hull of the union of two sets is the hull of the union
+ * of their hulls, so the last hull is the hull of all the points, while only one chunk and one hull are ever held in
+ * memory.
+ *
+ * Like MonotoneChainEngine, points that lie on an edge of the hull are not part of it, and duplicate points are only
+ * taken once.
+ *
+ * Usage:
+ * 1. Create an instance of the StreamingHull class with the number of points in a chunk.
+ * 2. Call add() for every point, or addFile() to stream the points of a file.
+ * 3. Call getConvexHull() to get the points on the convex hull.
+ *
+ */
+class StreamingHull
+{
+  public:
+    /**
+     * @brief The number of points in a chunk by default.
+     *
+     */
+    static const int DEFAULT_CHUNK_SIZE = 1 << 20;
+
+    /**
+     * @brief Constructs a new Streaming Hull object with no points.
+     *
+     * @param chunkSize The number of points gathered before they are folded into the hull.
+     */
+    StreamingHull(int chunkSize = DEFAULT_CHUNK_SIZE);
+    /**
+     * @brief Adds a point.
+     *
+     * @param p The point.
+     */
+    void add(Vector2 p);
+    /**
+     * @brief Adds all the points of a file, in the "(x, y)" format of the files dropped on the settings window, one
+     * chunk at a time. A file that cannot be mapped, such as the standard input, is read a block at a time, so only
+     * one block of it is held besides the chunk and the hull.
+     *
+     * @param filePath The path to the file.
+     * @return true If the whole file was read.
+     * @return false If the file could not be opened or does not follow the format, the points before the error being
+     * added, in which case getError() tells why.
+     */
+    bool addFile(const std::string &filePath);
+    /**
+     * @brief Gets what went wrong in the last call to addFile().
+     *
+     * @return const std::string& The path, the line number and the reason, empty if nothing went wrong.
+     */
+    const std::string &getError() const;
+    /**
+     * @brief Gets all the points on the convex hull of the points added so far, folding the chunk being gathered into
+     * it first.
+     *
+     * @return const std::vector<Vector2>& All the points on the convex hull, in the same order as
+     * MonotoneChainEngine.
+     */
+    const std::vector<Vector2> &getConvexHull();
+    /**
+     * @brief Gets the number of points added so far, counting every copy of a point.
+     *
+     * @return long long The number of points.
+     */
+    long long getPointCount() const;
+
+  private:
+    /**
+     * @brief Folds the points of the chunk into the hull and empties the chunk.
+     *
+     */
+    void fold();
+
+    /**
+     * @brief The number of points gathered before they are folded into the hull.
+     *
+     */
+    int chunkSize;
+    /**
+     * @brief The points added since the last fold.
+     *
+     */
+    std::vector<Vector2> chunk;
+    /**
+     * @brief The convex hull of the points folded so far.
+     *
+     */
+    std::vector<Vector2> hull;
+    /**
+     * @brief The number of points added so far.
+     *
+     */
+    long long pointCount = 0;
+    /**
+     * @brief What went wrong in the last call to addFile(), empty if nothing did.
+     *
+     */
+    std::string error;
+};
+
+#endif // STREAMING_HULL_H
\ No newline at end of file
@@ -0,0 +1,334 @@
+/**
+ * @file task_scheduler.h
+ * @brief Contains the declaration of the TaskScheduler class.
+ *
+ * This class implements a work stealing thread pool for divide and conquer algorithms.
+ *
+ */
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Represents the TaskScheduler class, a pool of worker threads that run fork-join tasks with work stealing.
+ *
+ * Every worker has its own queue of tasks. A worker pushes the tasks it forks to the back of its own queue and pops
+ * them from there, so a subproblem usually runs on the thread that created it, while idle workers steal the oldest,
+ * and so largest, subproblems from the front of the queues of the others. A worker waiting for a forked task keeps
+ * running tasks in the meantime, so nested forks never block a thread.
+ *
+ * Tasks never allocate: they point to callables living on the stack of the thread that forked them, which waits for
+ * them before returning.
+ *
+ * Usage:
+ * 1. Get the TaskScheduler::shared() scheduler, or create one with the number of worker threads to use.
+ * 2. Call run() from outside the pool to run a task on the workers and wait for it.
+ * 3. Inside that task, call invoke() to run two independent subproblems in parallel.
+ *
+ * On the web there are no threads, so tasks run on the calling thread one after the other.
+ *
+ */
+class TaskScheduler
+{
+  public:
+    /**
+     * @brief Constructs a new Task Scheduler object and starts its worker threads.
+     *
+     * @param threadCount The number of worker threads, where 0 uses one thread for every hardware thread.
+     */
+    TaskScheduler(int threadCount = 0);
+    /**
+     * @brief Destroys the Task Scheduler object, after its workers have finished their tasks.
+     *
+     */
+    ~TaskScheduler();
+    TaskScheduler(const TaskScheduler &) = delete;
+    TaskScheduler &operator=(const TaskScheduler &) = delete;
+
+    /**
+     * @brief Gets the number of worker threads.
+     *
+     * @return int The number of worker threads, at least 1.
+     */
+    int getThreadCount() const;
+    /**
+     * @brief Gets the index of the calling thread among the workers of this scheduler.
+     *
+     * @return int The index of the worker, from 0 to getThreadCount() - 1, or -1 if the calling thread is not one of
+     * the workers.
+     */
+    int getWorkerIndex() const;
+    /**
+     * @brief Runs a task on the worker threads and waits for it to finish. When called from a worker of this scheduler
+     * the task simply runs on the calling thread.
+     *
+     * @param task The task to run.
+     */
+    template <typename Callable> void run(Callable &&task);
+    /**
+     * @brief Runs two tasks in parallel and waits for both of them to finish. The first one may be stolen by another
+     * worker while the calling thread runs the second one. When not called from a worker of this scheduler, the tasks
+     * run one after the other on the calling thread.
+     *
+     * @param first The first task.
+     * @param second The second task.
+     */
+    template <typename First, typename Second> void invoke(First &&first, Second &&second);
+    /**
+     * @brief Calls a function for every index of a range and waits for all the calls to finish. The range is split in
+     * halves with invoke() down to single indices, so each index should stand for a sizeable chunk of work.
+     *
+     * @param begin The first index.
+     * @param end One past the last index.
+     * @param body The function, called with each index.
+     */
+    template <typename Body> void parallelFor(int begin, int end, Body &&body);
+
+    /**
+     * @brief Gets the scheduler shared by the whole program, creating it on first use.
+     *
+     * @return TaskScheduler& The shared scheduler.
+     */
+    static TaskScheduler &shared();
+    /**
+     * @brief Sets the number of worker threads of the shared scheduler. The shared scheduler is recreated on its next
+     * use, so this must not be called while it is running tasks.
+     *
+     * @param threadCount The number of worker threads, where 0 uses one thread for every hardware thread.
+     */
+    static void setSharedThreadCount(int threadCount);
+
+  private:
+    /**
+     * @brief Represents a forked task.
+     *
+     */
+    struct Task
+    {
+        /**
+         * @brief Calls the callable.
+         *
+         */
+        void (*call)(void *callable);
+        /**
+         * @brief The callable, owned by the thread that forked the task.
+         *
+         */
+        void *callable;
+        /**
+         * @brief Decremented once the task has finished.
+         *
+         */
+        std::atomic<int> *pending;
+        /**
+         * @brief Set to the exception thrown by the task, if any.
+         *
+         */
+        std::exception_ptr *error;
+        /**
+         * @brief Whether a thread outside the pool is waiting for the task on TaskScheduler::taskFinished.
+         *
+         */
+        bool submitted;
+    };
+    /**
+     * @brief Represents a worker thread along with its queue of tasks.
+     *
+     */
+    struct Worker
+    {
+        /**
+         * @brief Guards Worker::tasks.
+         *
+         */
+        std::mutex mutex;
+        /**
+         * @brief The tasks forked by this worker, newest at the back.
+         *
+         */
+        std::deque<Task> tasks;
+        /**
+         * @brief The thread of the worker.
+         *
+         */
+        std::thread thread;
+    };
+
+    /**
+     * @brief Calls a callable of the given type through a type erased pointer.
+     *
+     * @param callable Pointer to the callable.
+     */
+    template <typename Callable> static void callAs(void *callable);
+    /**
+     * @brief Calls a function for every index of a non-empty range, forking one half of the range at every level.
+     *
+     * @param begin The first index.
+     * @param end One past the last index.
+     * @param body The function, called with each index.
+     */
+    template <typename Body> void forkRange(int begin, int end, Body &body);
+    /**
+     * @brief Runs a task, storing the exception it throws, and marks it as finished.
+     *
+     * @param task The task.
+     */
+    void execute(const Task &task);
+    /**
+     * @brief Pushes a task to the queue of a worker and wakes up a sleeping worker to steal it.
+     *
+     * @param workerIndex The index of the worker.
+     * @param task The task.
+     */
+    void push(int workerIndex, const Task &task);
+    /**
+     * @brief Runs one task, taking the newest task of the given worker, or else the oldest task of another worker.
+     *
+     * @param workerIndex The index of the worker looking for a task.
+     * @return true If a task was run.
+     * @return false If there were no tasks.
+     */
+    bool runOne(int workerIndex);
+    /**
+     * @brief Runs tasks until the given counter drops to zero.
+     *
+     * @param workerIndex The index of the waiting worker.
+     * @param pending The counter to wait for.
+     */
+    void waitFor(int workerIndex, std::atomic<int> &pending);
+    /**
+     * @brief The loop run by every worker thread.
+     *
+     * @param workerIndex The index of the worker.
+     */
+    void workerLoop(int workerIndex);
+
+    /**
+     * @brief The workers, empty on the web.
+     *
+     */
+    std::vector<std::unique_ptr<Worker>> workers;
+    /**
+     * @brief The number of tasks waiting in the queues of all workers.
+     *
+     */
+    std::atomic<int> queuedTasks{0};
+    /**
+     * @brief Set when the scheduler is being destroyed.
+     *
+     */
+    std::atomic<bool> stopping{false};
+    /**
+     * @brief Guards sleeping and waking up of workers, and of threads waiting in run().
+     *
+     */
+    std::mutex sleepMutex;
+    /**
+     * @brief Notified when a task is queued or the scheduler is stopping.
+     *
+     */
+    std::condition_variable taskQueued;
+    /**
+     * @brief Notified when a task submitted by run() has finished.
+     *
+     */
+    std::condition_variable taskFinished;
+    /**
+     * @brief Rotates the worker to which tasks submitted from outside the pool are given.
+     *
+     */
+    std::atomic<unsigned> nextSubmission{0};
+    /**
+     * @brief The scheduler whose worker is the calling thread, if any.
+     *
+     */
+    static thread_local TaskScheduler *currentScheduler;
+    /**
+     * @brief The index of the calling thread among the workers of TaskScheduler::currentScheduler.
+     *
+     */
+    static thread_local int currentWorkerIndex;
+};
+
+template <typename Callable> void TaskScheduler::callAs(void *callable)
+{
+    (*static_cast<Callable *>(callable))();
+}
+
+template <typename Callable> void TaskScheduler::run(Callable &&task)
+{
+    if (workers.empty() || currentScheduler == this)
+    {
+        task();
+        return;
+    }
+
+    std::atomic<int> pending{1};
+    std::exception_ptr error;
+    int workerIndex = nextSubmission++ % workers.size();
+    push(workerIndex, {&callAs<std::remove_reference_t<Callable>>, &task, &pending, &error, true});
+    {
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        taskFinished.wait(lock, [&pending]() { return pending.load(std::memory_order_acquire) == 0; });
+    }
+    if (error)
+        std::rethrow_exception(error);
+}
+
+template <typename First, typename Second> void TaskScheduler::invoke(First &&first, Second &&second)
+{
+    if (currentScheduler != this)
+    {
+        first();
+        second();
+        return;
+    }
+
+    int workerIndex = currentWorkerIndex;
+    std::atomic<int> pending{1};
+    std::exception_ptr error;
+    push(workerIndex, {&callAs<std::remove_reference_t<First>>, &first, &pending, &error, false});
+    // the first task points into this stack frame, so it has to finish even if the second one throws
+    try
+    {
+        second();
+    }
+    catch (...)
+    {
+        waitFor(workerIndex, pending);
+        throw;
+    }
+    waitFor(workerIndex, pending);
+    if (error)
+        std::rethrow_exception(error);
+}
+
+template <typename Body> void TaskScheduler::parallelFor(int begin, int end, Body &&body)
+{
+    if (end - begin == 1)
+        body(begin);
+    else if (end - begin > 1)
+        run([&]() { forkRange(begin, end, body); });
+}
+
+template <typename Body> void TaskScheduler::forkRange(int begin, int end, Body &body)
+{
+    if (end - begin == 1)
+    {
+        body(begin);
+        return;
+    }
+    int mid = begin + (end - begin) / 2;
+    invoke([&]() { forkRange(begin, mid, body); }, [&]() { forkRange(mid, end, body); });
+}
+
+#endif // TASK_SCHEDULER_H
\ No newline at end of file
@@ -6,8 +6,16 @@
  */
 #define RAYGUI_IMPLEMENTATION
 
+#include "approximate_hull.h"
+#include "chan.h"
+#include "convex_layers.h"
+#include "dynamic_hull.h"
+#include "incremental_hull.h"
 #include "jarvis_march.h"
 #include "kirk_patrick_seidel.h"
+#include "monotone_chain.h"
+#include "point_file_writer.h"
+#include "quick_hull.h"
 #include "raygui.h"
 #include "raylib.h"
 #include "settings.h"
@@ -57,11 +65,21 @@ EM_JS(void, createFileDownload, (const char *data, int dataLength), {
  * It includes the following algorithms:
  *   - JARVIS_MARCH: Jarvis March Algorithm
  *   - KIRK_PATRICK_SEIDEL: Kirk Patrick Seidel Algorithm
+ *   - MONOTONE_CHAIN: Andrew's Monotone Chain Algorithm
+ *   - CHAN: Chan's Algorithm
+ *   - QUICK_HULL: QuickHull Algorithm
+ *   - APPROXIMATE_HULL: Approximate hull of Bentley, Faust and Preparata
+ *   - CONVEX_LAYERS: Convex layers, peeled one at a time
  */
 enum Algorithms
 {
     JARVIS_MARCH,
-    KIRK_PATRICK_SEIDEL
+    KIRK_PATRICK_SEIDEL,
+    MONOTONE_CHAIN,
+    CHAN,
+    QUICK_HULL,
+    APPROXIMATE_HULL,
+    CONVEX_LAYERS
 };
 /**
  * @brief Represents the custom font used for rendering which is set as default for raygui
@@ -79,6 +97,11 @@ int selectedAlgorithm = 0;
  * changed.
  */
 int previousAlgorithm = selectedAlgorithm;
+/**
+ * @brief Indicates whether the approximate hull is refined to the exact hull in the background.
+ *
+ */
+bool refineApproximateHull = true;
 /**
  * @brief Indicates whether the dropdown menu is open.
  *
@@ -199,6 +222,28 @@ const float toolbarHeight = 50;
  *
  */
 std::vector<Vector2> dataPoints;
+/**
+ * @brief The convex hull of dataPoints while points are only added, in O(log h) per point, so that it can be drawn while
+ * editing.
+ *
+ */
+IncrementalHull insertionHull;
+/**
+ * @brief The convex hull of dataPoints once a point has been removed, updated in O(log^3 n) per point added or removed.
+ *
+ */
+DynamicHull editingHull;
+/**
+ * @brief Whether a point was removed since the points were last replaced, so that editingHull holds the hull instead
+ * of insertionHull.
+ *
+ */
+bool pointsRemoved = false;
+/**
+ * @brief The points on the hull being edited, gathered again only when it changes.
+ *
+ */
+std::vector<Vector2> editingHullPoints;
 /**
  * @brief Indicates whether to visualize the algorithm one step at a time. If false, it is played automatically.
  *
@@ -239,6 +284,16 @@ const float bottomBarHeight = 60;
  *
  */
 static void UpdateDrawFrame(void);
+/**
+ * @brief Creates the ConvexHullAlgorithm object of the selected algorithm for the current points.
+ *
+ */
+static void CreateConvexHullAlgorithm(void);
+/**
+ * @brief Builds insertionHull again from all the points, for when they were replaced.
+ *
+ */
+static void RebuildEditingHull(void);
 /**
  * @brief Represents a timer for controlling frame updates.
  *
@@ -322,17 +377,41 @@ static void UpdateDrawFrame(void)
                 settings.checkPointValidity(mousePos, &showSettings))
             {
                 dataPoints.push_back(mousePos);
+                if (pointsRemoved)
+                {
+                    editingHull.insert(mousePos);
+                    editingHullPoints = editingHull.getConvexHull();
+                }
+                else if (insertionHull.insert(mousePos))
+                    editingHullPoints = insertionHull.getConvexHull();
             }
         }
         else if (IsMouseButtonPressed(MOUSE_BUTTON_RIGHT))
         {
             if (dataPoints.size() > 0)
             {
-                dataPoints.pop_back();
+                // the point under the mouse is removed, the last drawn one first, or else the last added point
+                Vector2 mousePos = GetMousePosition();
+                size_t index = dataPoints.size() - 1;
+                for (size_t i = dataPoints.size(); i-- > 0;)
+                {
+                    if (CheckCollisionPointCircle(mousePos, dataPoints[i], 5))
+                    {
+                        index = i;
+                        break;
+                    }
+                }
+                // the hull only supports removals from the first one on, so it is built once from all the points
+                if (!pointsRemoved)
+                {
+                    editingHull = DynamicHull(dataPoints);
+                    pointsRemoved = true;
+                }
+                editingHull.erase(dataPoints[index]);
+                dataPoints.erase(dataPoints.begin() + index);
+                editingHullPoints = editingHull.getConvexHull();
             }
         }
-        selectedAlgorithm == JARVIS_MARCH ? ch = std::make_unique<JarvisMarch>(dataPoints)
-                                          : ch = std::make_unique<KirkpatrickSeidel>(dataPoints);
     }
 
     if (!showConvexHull)
@@ -340,6 +419,7 @@ static void UpdateDrawFrame(void)
         if (IsKeyPressed(KEY_C))
         {
             dataPoints.clear();
+            RebuildEditingHull();
         }
     }
 
@@ -367,7 +447,7 @@ static void UpdateDrawFrame(void)
         GuiSetStyle(DEFAULT, TEXT_SIZE, 30);
         GuiDrawText("How to use the GUI", {x, y, 700, 30}, TEXT_ALIGN_CENTER, BLACK);
         GuiDrawText("- Left Click anywhere on the canvas to add points", {x, y + 40, 800, 30}, TEXT_ALIGN_LEFT, BLACK);
-        GuiDrawText("- Right Click anywhere on the canvas to remove last added point", {x, y + 2 * 40, 800, 30},
+        GuiDrawText("- Right Click a point to remove it (elsewhere: last added point)", {x, y + 2 * 40, 800, 30},
                     TEXT_ALIGN_LEFT, BLACK);
         GuiDrawText("- Visit the settings window for more options", {x, y + 3 * 40, 800, 30}, TEXT_ALIGN_LEFT, BLACK);
         GuiDrawText("- When NOT visualizing press C to clear the canvas", {x, y + 4 * 40, 800, 30}, TEXT_ALIGN_LEFT,
@@ -391,6 +471,39 @@ static void UpdateDrawFrame(void)
         GuiDrawText("Kirkpatrick-Seidel Algorithm", {10, 10, 300, 30}, TEXT_ALIGN_LEFT, BLACK);
     }
     break;
+    case MONOTONE_CHAIN: {
+        GuiDrawText("Monotone Chain Algorithm", {10, 10, 300, 30}, TEXT_ALIGN_LEFT, BLACK);
+    }
+    break;
+    case CHAN: {
+        GuiDrawText("Chan's Algorithm", {10, 10, 300, 30}, TEXT_ALIGN_LEFT, BLACK);
+    }
+    break;
+    case QUICK_HULL: {
+        GuiDrawText("QuickHull Algorithm", {10, 10, 300, 30}, TEXT_ALIGN_LEFT, BLACK);
+    }
+    break;
+    case APPROXIMATE_HULL: {
+        GuiDrawText("Approximate Hull", {10, 10, 300, 30}, TEXT_ALIGN_LEFT, BLACK);
+        if (!showConvexHull)
+            GuiCheckBox({200, 15, 20, 20}, "Refine to exact hull", &refineApproximateHull);
+    }
+    break;
+    case CONVEX_LAYERS: {
+        GuiDrawText("Convex Layers", {10, 10, 300, 30}, TEXT_ALIGN_LEFT, BLACK);
+    }
+    break;
+    }
+
+    // the hull of the points is drawn faintly while editing them
+    if (!showConvexHull)
+    {
+        for (size_t i = 0; i + 1 < editingHullPoints.size(); i++)
+        {
+            DrawLineV(editingHullPoints[i], editingHullPoints[i + 1], LIGHTGRAY);
+        }
+        if (editingHullPoints.size() > 2)
+            DrawLineV(editingHullPoints.back(), editingHullPoints.front(), LIGHTGRAY);
     }
 
     for (size_t i = 0; i < dataPoints.size(); i++)
@@ -415,7 +528,8 @@ static void UpdateDrawFrame(void)
     // Toolbar
     GuiLine(Rectangle{0, toolbarHeight, static_cast<float>(GetScreenWidth()), 0}, NULL);
     if (GuiDropdownBox(Rectangle{static_cast<float>(GetScreenWidth() - 260), 10, 250, 30},
-                       "Jarvis March;Kirkpatrick-Seidel", &selectedAlgorithm, isDropdownOpen))
+                       "Jarvis March;Kirkpatrick-Seidel;Monotone Chain;Chan;QuickHull;Approximate Hull;Convex Layers",
+                       &selectedAlgorithm, isDropdownOpen))
     {
         isDropdownOpen = !isDropdownOpen;
         if (previousAlgorithm != selectedAlgorithm)
@@ -438,6 +552,9 @@ static void UpdateDrawFrame(void)
         showConvexHull = !showConvexHull;
         showSettings = false;
         showLegend = false;
+        // the steps are only computed when the hull is shown, not every time the points change
+        if (showConvexHull)
+            CreateConvexHullAlgorithm();
     }
     // enable the remaining GUI
     if (dataPoints.size() == 0)
@@ -463,17 +580,18 @@ static void UpdateDrawFrame(void)
         if (GuiButton(Rectangle{static_cast<float>(GetScreenWidth() - 970), 10, 150, 30}, "Export Hull"))
         {
             std::vector<Vector2> hull = ch->exportHull();
-            std::string hullString;
-            for (auto point : hull)
+            for (auto &point : hull)
             {
-                hullString.append("(" + std::to_string((point.x - 25.0f) / scale + centerX) + "," +
-                                  std::to_string((point.y - 25.0f - toolbarHeight) / scale + centerY) + ")\n");
+                point = {(point.x - 25.0f) / scale + centerX, (point.y - 25.0f - toolbarHeight) / scale + centerY};
             }
+            PointFileWriter writer;
+            writer.addPoints(hull);
 
 #if defined(PLATFORM_WEB)
-            createFileDownload(hullString.c_str(), hullString.size());
+            createFileDownload(writer.getData(), writer.getSize());
 #else
-            SaveFileText("hull.txt", const_cast<char *>(hullString.c_str()));
+            if (!writer.save("hull.txt"))
+                TraceLog(LOG_WARNING, "%s", writer.getError().c_str());
 #endif
         }
 
@@ -519,8 +637,47 @@ static void UpdateDrawFrame(void)
                        bottomBarHeight, "Legend");
         lastStep = currentStep;
     }
-    settings.showSettings(&showSettings, toolbarHeight, bottomBarHeight, &scale, &duration, filePath, &isFilePathAdded,
-                          &numberOfPoints, fileDataPoints, dataPoints, centerX, centerY);
+    if (settings.showSettings(&showSettings, toolbarHeight, bottomBarHeight, &scale, &duration, filePath,
+                              &isFilePathAdded, &numberOfPoints, fileDataPoints, dataPoints, centerX, centerY))
+    {
+        RebuildEditingHull();
+    }
     EndDrawing();
     //----------------------------------------------------------------------------------
+}
+
+static void CreateConvexHullAlgorithm(void)
+{
+    switch (static_cast<Algorithms>(selectedAlgorithm))
+    {
+    case JARVIS_MARCH:
+        ch = std::make_unique<JarvisMarch>(dataPoints);
+        break;
+    case KIRK_PATRICK_SEIDEL:
+        ch = std::make_unique<KirkpatrickSeidel>(dataPoints);
+        break;
+    case MONOTONE_CHAIN:
+        ch = std::make_unique<MonotoneChain>(dataPoints);
+        break;
+    case CHAN:
+        ch = std::make_unique<Chan>(dataPoints);
+        break;
+    case QUICK_HULL:
+        ch = std::make_unique<QuickHull>(dataPoints);
+        break;
+    case APPROXIMATE_HULL:
+        ch = std::make_unique<ApproximateHull>(dataPoints, refineApproximateHull);
+        break;
+    case CONVEX_LAYERS:
+        ch = std::make_unique<ConvexLayers>(dataPoints);
+        break;
+    }
+}
+
+static void RebuildEditingHull(void)
+{
+    insertionHull = IncrementalHull(dataPoints);
+    editingHull = DynamicHull();
+    pointsRemoved = false;
+    editingHullPoints = insertionHull.getConvexHull();
 }
\ No newline at end of file
@@ -0,0 +1,61 @@
+// Compares computing the hulls of many small point sets with BatchHull against one MonotoneChainEngine per set.
+// Build: g++ -O3 -pthread -I../include -I../external/raylib-desktop/include batch.cpp ../src/batch_hull.cpp
+//        ../src/monotone_chain_engine.cpp ../src/task_scheduler.cpp -o batch
+// Usage: ./batch [number of sets] [largest set size] [max threads]
+#include "batch_hull.h"
+#include "monotone_chain_engine.h"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+int main(int argc, char **argv)
+{
+    int setCount = argc > 1 ? atoi(argv[1]) : 100000;
+    int maxSetSize = argc > 2 ? atoi(argv[2]) : 200;
+    int maxThreads = argc > 3 ? atoi(argv[3]) : max(1u, thread::hardware_concurrency());
+
+    // the sets have from 10 to maxSetSize points spread uniformly over a square
+    mt19937 rng(1);
+    uniform_int_distribution<int> size(min(10, maxSetSize), maxSetSize);
+    uniform_real_distribution<float> coordinate(0, 1000);
+    vector<float> xs, ys;
+    vector<int> offsets = {0};
+    for (int i = 0; i < setCount; i++)
+    {
+        for (int n = size(rng); n > 0; n--)
+        {
+            xs.push_back(coordinate(rng));
+            ys.push_back(coordinate(rng));
+        }
+        offsets.push_back(xs.size());
+    }
+    cout << setCount << " sets, " << xs.size() << " points" << endl;
+
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < setCount; i++)
+    {
+        vector<Vector2> P;
+        for (int j = offsets[i]; j < offsets[i + 1]; j++)
+            P.push_back((Vector2){xs[j], ys[j]});
+        MonotoneChainEngine<NoRecord> engine(P);
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    cout << setw(8) << "engines" << setw(12) << fixed << setprecision(4) << elapsed.count() << endl;
+
+    cout << setw(8) << "threads" << setw(12) << "time (s)" << endl;
+    BatchHull batch;
+    for (int threads = 1; threads <= maxThreads; threads++)
+    {
+        TaskScheduler::setSharedThreadCount(threads);
+        start = chrono::steady_clock::now();
+        batch.compute(xs.data(), ys.data(), offsets.data(), setCount);
+        elapsed = chrono::steady_clock::now() - start;
+        cout << setw(8) << threads << setw(12) << elapsed.count() << endl;
+    }
+    return 0;
+}
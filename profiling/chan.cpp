@@ -0,0 +1,30 @@
+#include "chan_engine.h"
+#include "point_file_reader.h"
+#include "point_file_writer.h"
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+int main()
+{
+    vector<Vector2> P;
+
+    const std::string filePath = "./in.txt";
+    PointFileReader reader;
+    if (!reader.open(filePath) || !reader.readAll(P))
+    {
+        cerr << reader.getError() << endl;
+        return 1;
+    }
+    ChanEngine<NoRecord> engine(P);
+    const std::string outputFilePath = "./chanout.txt";
+    PointFileWriter writer(PointFileWriter::TEXT, 0);
+    writer.addPoints(engine.getConvexHull());
+    if (!writer.save(outputFilePath))
+    {
+        cerr << writer.getError() << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -1,15 +1,11 @@
+#include "point_file_reader.h"
+#include "point_file_writer.h"
 #include <algorithm>
-#include <fstream>
-#include <iomanip>
 #include <iostream>
 #include <vector>
 
 using namespace std;
 
-struct Vector2
-{
-    float x, y;
-};
 bool operator==(const Vector2 &lhs, const Vector2 &rhs)
 {
     return lhs.x == rhs.x && lhs.y == rhs.y;
@@ -81,20 +77,20 @@ int main()
 {
     vector<Vector2> points;
     const std::string inputFilePath = "./in.txt";
-    std::ifstream istream(inputFilePath);
-    float x, y;
-    char openParenthesis = '(', closeParenthesis = ')', separator = ',';
-    while (istream >> openParenthesis >> x >> separator >> y >> closeParenthesis)
+    PointFileReader reader;
+    if (!reader.open(inputFilePath) || !reader.readAll(points))
     {
-        points.push_back({x, y});
+        cerr << reader.getError() << endl;
+        return 1;
     }
     auto result = computeConvexHull(points);
     const std::string outputFilePath = "./collinearjarvisout.txt";
-    std::ofstream ostream(outputFilePath);
-    for (auto &point : result)
+    PointFileWriter writer(PointFileWriter::TEXT, 0);
+    writer.addPoints(result);
+    if (!writer.save(outputFilePath))
     {
-        ostream << fixed << std::setprecision(0) << openParenthesis << point.x << separator << point.y
-                << closeParenthesis << endl;
+        cerr << writer.getError() << endl;
+        return 1;
     }
     return 0;
 }
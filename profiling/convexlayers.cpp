@@ -0,0 +1,34 @@
+#include "convex_layers_engine.h"
+#include "point_file_reader.h"
+#include "point_file_writer.h"
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+int main()
+{
+    vector<Vector2> P;
+
+    const std::string filePath = "./in.txt";
+    PointFileReader reader;
+    if (!reader.open(filePath) || !reader.readAll(P))
+    {
+        cerr << reader.getError() << endl;
+        return 1;
+    }
+    ConvexLayersEngine<NoRecord> engine(P);
+    const std::string outputFilePath = "./convexlayersout.txt";
+    PointFileWriter writer(PointFileWriter::TEXT, 0);
+    for (int layer = 0; layer < engine.getLayerCount(); layer++)
+    {
+        writer.addPoints(engine.getLayer(layer));
+        writer.addBlankLine();
+    }
+    if (!writer.save(outputFilePath))
+    {
+        cerr << writer.getError() << endl;
+        return 1;
+    }
+    return 0;
+}
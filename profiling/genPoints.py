@@ -11,6 +11,15 @@ def generate_random_points(num_points, min_value, max_value):
         points.append((x, y))
     return points
 
+def generate_nearly_sorted_points(num_points, min_value, max_value):
+    # points sorted by x, with about one in a hundred swapped with a close neighbour
+    points = sorted(generate_random_points(num_points, min_value, max_value))
+    for _ in range(num_points // 100):
+        i = random.randrange(num_points)
+        j = min(num_points - 1, i + random.randint(1, 10))
+        points[i], points[j] = points[j], points[i]
+    return points
+
 def drawPolygon(vertex_points, num_points, radius):
     angle = 0
     angle_increment = 360 / vertex_points 
@@ -34,8 +43,8 @@ def drawPolygon(vertex_points, num_points, radius):
 
 flag = sys.argv[1]
 num_points = 0
-if flag != "--uniform" and flag != "--polygon":
-    print("Invalid flag. Use --uniform or --polygon")
+if flag != "--uniform" and flag != "--polygon" and flag != "--nearlysorted":
+    print("Invalid flag. Use --uniform, --polygon or --nearlysorted")
     sys.exit(1)
 else:
     num_points = int(sys.argv[2])
@@ -44,6 +53,8 @@ else:
     vertex_points = num_points
     if flag == "--uniform":
         random_points = generate_random_points(num_points, min_value, max_value)
+    elif flag == "--nearlysorted":
+        random_points = generate_nearly_sorted_points(num_points, min_value, max_value)
     else:
         random_points = drawPolygon(vertex_points, num_points, num_points)
 
@@ -0,0 +1,32 @@
+#include "hull_prefilter.h"
+#include "jarvis_march_engine.h"
+#include "point_file_reader.h"
+#include "point_file_writer.h"
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+int main()
+{
+    vector<Vector2> points;
+    const std::string inputFilePath = "./in.txt";
+    PointFileReader reader;
+    if (!reader.open(inputFilePath) || !reader.readAll(points))
+    {
+        cerr << reader.getError() << endl;
+        return 1;
+    }
+    HullPrefilter prefilter;
+    JarvisMarchEngine<NoRecord> engine(prefilter.filter(points));
+    cerr << "discarded " << prefilter.getDiscardedCount() << " of " << points.size() << " points" << endl;
+    const std::string outputFilePath = "./jarvisprefilterout.txt";
+    PointFileWriter writer(PointFileWriter::TEXT, 0);
+    writer.addPoints(engine.getConvexHull());
+    if (!writer.save(outputFilePath))
+    {
+        cerr << writer.getError() << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -1,6 +1,6 @@
+#include "point_file_reader.h"
+#include "point_file_writer.h"
 #include <algorithm>
-#include <fstream>
-#include <iomanip>
 #include <iostream>
 #include <limits>
 #include <raymath.h>
@@ -361,20 +361,20 @@ int main()
     vector<Vector2> P;
 
     const std::string filePath = "./in.txt";
-    std::ifstream istream(filePath);
-    float x, y;
-    char openParenthesis = '(', closeParenthesis = ')', separator = ',';
-    while (istream >> openParenthesis >> x >> separator >> y >> closeParenthesis)
+    PointFileReader reader;
+    if (!reader.open(filePath) || !reader.readAll(P))
     {
-        P.push_back((Vector2){x, y});
+        cerr << reader.getError() << endl;
+        return 1;
     }
     vector<Vector2> res = convex_hull(P);
     const std::string outputFilePath = "./kpsnomomout.txt";
-    std::ofstream ostream(outputFilePath);
-    for (auto h : res)
+    PointFileWriter writer(PointFileWriter::TEXT, 0);
+    writer.addPoints(res);
+    if (!writer.save(outputFilePath))
     {
-        ostream << fixed << std::setprecision(0) << openParenthesis << h.x << separator << h.y << closeParenthesis
-                << endl;
+        cerr << writer.getError() << endl;
+        return 1;
     }
     return 0;
 }
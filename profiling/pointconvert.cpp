@@ -0,0 +1,51 @@
+// Converts a file of points in the "(x, y)" text format to the binary point format, optionally with its convex hull.
+// Build: g++ -O3 -pthread -I../include -I../external/raylib-desktop/include pointconvert.cpp
+//        ../src/point_file_reader.cpp ../src/binary_point_file.cpp ../src/mapped_file.cpp
+//        ../src/monotone_chain_engine.cpp ../src/task_scheduler.cpp -o pointconvert
+// Usage: ./pointconvert [input file] [output file] [--hull]
+#include "binary_point_file.h"
+#include "monotone_chain_engine.h"
+#include "point_file_reader.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+int main(int argc, char **argv)
+{
+    const std::string inputFilePath = argc > 1 ? argv[1] : "./in.txt";
+    const std::string outputFilePath = argc > 2 ? argv[2] : "./in.bin";
+    bool withHull = argc > 3 && std::string(argv[3]) == "--hull";
+
+    auto start = chrono::steady_clock::now();
+    vector<Vector2> points;
+    PointFileReader reader;
+    if (!reader.open(inputFilePath) || !reader.readAll(points))
+    {
+        cerr << reader.getError() << endl;
+        return 1;
+    }
+    chrono::duration<double> parsing = chrono::steady_clock::now() - start;
+
+    vector<Vector2> hull;
+    if (withHull)
+        hull = MonotoneChainEngine<NoRecord>(points).getConvexHull();
+    std::string error;
+    if (!BinaryPointFile::write(outputFilePath, points, hull, error))
+    {
+        cerr << error << endl;
+        return 1;
+    }
+
+    start = chrono::steady_clock::now();
+    vector<Vector2> loaded;
+    reader.open(outputFilePath);
+    reader.readAll(loaded);
+    chrono::duration<double> loading = chrono::steady_clock::now() - start;
+    cout << points.size() << " points" << (withHull ? ", " + to_string(hull.size()) + " on the hull" : "") << ", "
+         << fixed << setprecision(4) << parsing.count() << " s to parse the text, " << loading.count()
+         << " s to load the binary file" << endl;
+    return 0;
+}
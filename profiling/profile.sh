@@ -1,6 +1,9 @@
 #!/usr/bin/bash
 maxExponent=7
 files="$@"
+# the programs that use the hull engines from src/ are linked against them
+includes="-I../include -I../external/raylib-desktop/include"
+engines="../src/jarvis_march_engine.cpp ../src/kirk_patrick_seidel_engine.cpp ../src/selection.cpp ../src/task_scheduler.cpp ../src/simd_kernels.cpp ../src/hull_prefilter.cpp ../src/monotone_chain_engine.cpp ../src/chan_engine.cpp ../src/quick_hull_engine.cpp ../src/approximate_hull_engine.cpp ../src/convex_layers_engine.cpp ../src/point_file_reader.cpp ../src/binary_point_file.cpp ../src/mapped_file.cpp ../src/point_file_writer.cpp"
 rm -r uniform
 rm -r polygon
 mkdir uniform
@@ -10,7 +13,7 @@ mkdir uniform/results
 mkdir polygon/logs
 mkdir polygon/results
 for f in $files; do
-    g++ -pg -O3 "$f".cpp -o "$f"
+    g++ -pg -O3 -std=c++20 -pthread $includes "$f".cpp $engines -o "$f"
     echo -n > uniform/"$f".txt
     echo -n > polygon/"$f".txt
     mkdir uniform/logs/"$f"
@@ -0,0 +1,56 @@
+// Reports how the Kirkpatrick-Seidel engine scales with the number of worker threads of the TaskScheduler.
+// Build: g++ -O3 -pthread -I../include -I../external/raylib-desktop/include scaling.cpp
+//        ../src/kirk_patrick_seidel_engine.cpp ../src/selection.cpp ../src/task_scheduler.cpp ../src/simd_kernels.cpp
+//        ../src/point_file_reader.cpp ../src/binary_point_file.cpp ../src/mapped_file.cpp -o scaling
+// Usage: python3 genPoints.py --uniform 10000000 && ./scaling [max threads] [number of runs] [grain size]
+#include "kirk_patrick_seidel_engine.h"
+#include "point_file_reader.h"
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+int main(int argc, char **argv)
+{
+    int maxThreads = argc > 1 ? atoi(argv[1]) : max(1u, thread::hardware_concurrency());
+    int runs = argc > 2 ? atoi(argv[2]) : 3;
+    int grainSize = argc > 3 ? atoi(argv[3]) : KirkpatrickSeidelEngine<NoRecord>::DEFAULT_GRAIN_SIZE;
+
+    vector<Vector2> P;
+    const std::string filePath = "./in.txt";
+    PointFileReader reader;
+    if (!reader.open(filePath) || !reader.readAll(P))
+    {
+        cerr << reader.getError() << endl;
+        return 1;
+    }
+    cout << P.size() << " points, grain size " << grainSize << ", best of " << runs << " runs" << endl;
+    cout << setw(8) << "threads" << setw(12) << "time (s)" << setw(10) << "speedup" << setw(12) << "efficiency"
+         << endl;
+
+    double serial = 0;
+    for (int threads = 1; threads <= maxThreads; threads++)
+    {
+        TaskScheduler::setSharedThreadCount(threads);
+        double best = 0;
+        for (int i = 0; i < runs; i++)
+        {
+            // the copy of the input is made before the timer starts, so only the work of the engine is timed
+            vector<Vector2> input = P;
+            auto start = chrono::steady_clock::now();
+            KirkpatrickSeidelEngine<NoRecord> engine(move(input), grainSize);
+            chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+            if (i == 0 || elapsed.count() < best)
+                best = elapsed.count();
+        }
+        if (threads == 1)
+            serial = best;
+        cout << setw(8) << threads << setw(12) << fixed << setprecision(4) << best << setw(10) << setprecision(2)
+             << serial / best << setw(12) << serial / best / threads << endl;
+    }
+    return 0;
+}
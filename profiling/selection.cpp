@@ -0,0 +1,141 @@
+// Compares the selection strategies used by the Kirkpatrick-Seidel implementations.
+// Build: g++ -O3 -I../include selection.cpp ../src/selection.cpp -o selection
+// Usage: ./selection [number of values] [number of runs]
+#include "selection.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+static long long allocations = 0;
+
+void *operator new(size_t size)
+{
+    allocations++;
+    if (void *p = malloc(size))
+        return p;
+    throw bad_alloc();
+}
+
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    free(p);
+}
+
+// the copying version from kps.cpp
+float median_of_medians(vector<float> &arr)
+{
+    int n = arr.size();
+    vector<vector<float>> matrix(n / 5 + (n % 5 != 0));
+    int i = 0, s = 0;
+
+    while (i < n)
+    {
+        int count = 0;
+        while (count < 5)
+        {
+            if (i < n)
+            {
+                matrix[s].push_back(arr[i]);
+                i++;
+            }
+            else
+                matrix[s].push_back(arr[n - 1]);
+            count++;
+        }
+        s++;
+    }
+
+    for (vector<float> &V : matrix)
+        sort(V.begin(), V.end());
+
+    return matrix[matrix.size() / 2][2];
+}
+
+float quick_select(vector<float> S, int rank)
+{
+    if (S.size() < rank)
+        return 0;
+    float x = median_of_medians(S);
+    int r = 0, dup = 0;
+    vector<float> L, R;
+
+    for (float e : S)
+    {
+        if (e < x)
+            L.push_back(e);
+        else if (e > x)
+            R.push_back(e);
+        else
+            dup++;
+    }
+    dup--;
+    r = L.size() + 1;
+
+    if (r == rank || (r < rank && (r + dup) >= rank))
+        return x;
+    else if (r > rank)
+        return quick_select(L, rank);
+    else
+        return quick_select(R, rank - (r + dup));
+}
+
+// the sorting version from kpsnomom.cpp
+float sorted_select(vector<float> S, int rank)
+{
+    sort(S.begin(), S.end());
+    return S[rank - 1];
+}
+
+// times finding x_mid the way halfHull does, from both middle ranks
+template <typename F>
+void report(const char *name, int runs, F middle)
+{
+    float result = 0;
+    allocations = 0;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < runs; i++)
+        result = middle();
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    cout << left << setw(24) << name << " time: " << fixed << setprecision(4) << elapsed.count() / runs
+         << "s allocations: " << allocations / runs << " x_mid: " << result << endl;
+}
+
+int main(int argc, char **argv)
+{
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int runs = argc > 2 ? atoi(argv[2]) : 5;
+
+    mt19937 rng(42);
+    uniform_int_distribution<int> distribution(-10 * n, 10 * n);
+    vector<float> values(n), scratch(n);
+    for (float &v : values)
+        v = distribution(rng);
+    int high = n / 2 + 1, low = max(1, n / 2);
+
+    report("median of medians", runs, [&]() { return (quick_select(values, high) + quick_select(values, low)) / 2; });
+    report("sort", runs, [&]() { return (sorted_select(values, high) + sorted_select(values, low)) / 2; });
+    report("in-place", runs, [&]() {
+        copy(values.begin(), values.end(), scratch.begin());
+        float first = Selection::select(scratch.data(), n, high);
+        copy(values.begin(), values.end(), scratch.begin());
+        return (first + Selection::select(scratch.data(), n, low)) / 2;
+    });
+    report("in-place (fused pair)", runs, [&]() {
+        copy(values.begin(), values.end(), scratch.begin());
+        pair<float, float> middle = Selection::selectPair(scratch.data(), n, high, low);
+        return (middle.first + middle.second) / 2;
+    });
+    return 0;
+}
\ No newline at end of file
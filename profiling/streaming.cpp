@@ -0,0 +1,43 @@
+// Computes the convex hull of a file of points one chunk at a time, so the file may be larger than the memory.
+// Build: g++ -O3 -pthread -I../include -I../external/raylib-desktop/include streaming.cpp ../src/streaming_hull.cpp
+//        ../src/monotone_chain_engine.cpp ../src/hull_prefilter.cpp ../src/task_scheduler.cpp
+//        ../src/point_file_reader.cpp ../src/binary_point_file.cpp ../src/mapped_file.cpp ../src/point_file_writer.cpp
+//        -o streaming
+// Usage: ./streaming [input file] [chunk size]
+#include "point_file_writer.h"
+#include "streaming_hull.h"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+int main(int argc, char **argv)
+{
+    const std::string filePath = argc > 1 ? argv[1] : "./in.txt";
+    int chunkSize = argc > 2 ? atoi(argv[2]) : StreamingHull::DEFAULT_CHUNK_SIZE;
+
+    auto start = chrono::steady_clock::now();
+    StreamingHull streamingHull(chunkSize);
+    if (!streamingHull.addFile(filePath))
+    {
+        cerr << streamingHull.getError() << endl;
+        return 1;
+    }
+    const vector<Vector2> &hull = streamingHull.getConvexHull();
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    cout << streamingHull.getPointCount() << " points, " << hull.size() << " on the hull, chunk size " << chunkSize
+         << ", " << fixed << setprecision(4) << elapsed.count() << " s" << endl;
+
+    const std::string outputFilePath = "./streamingout.txt";
+    PointFileWriter writer(PointFileWriter::TEXT, 0);
+    writer.addPoints(hull);
+    if (!writer.save(outputFilePath))
+    {
+        cerr << writer.getError() << endl;
+        return 1;
+    }
+    return 0;
+}
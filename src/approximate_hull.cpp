@@ -0,0 +1,303 @@
+/**
+ * @file approximate_hull.cpp
+ * @brief Contains the implementation of the ApproximateHull class.
+ *
+ */
+#include "approximate_hull.h"
+#include "kirk_patrick_seidel_engine.h"
+#include "raygui.h"
+
+ApproximateHull::ApproximateHull(std::vector<Vector2> p, bool refine)
+    : ApproximateHullEngine<Record>(std::move(p), STRIP_COUNT)
+{
+    if (!refine || points.empty())
+        return;
+#if defined(PLATFORM_WEB)
+    std::launch policy = std::launch::deferred;
+#else
+    std::launch policy = std::launch::async;
+#endif
+    refinement = std::async(policy, [input = points, flag = &cancelled]() {
+        return KirkpatrickSeidelEngine<NoRecord>(input, KirkpatrickSeidelEngine<NoRecord>::DEFAULT_GRAIN_SIZE, flag)
+            .getConvexHull();
+    });
+}
+
+ApproximateHull::~ApproximateHull()
+{
+    // the future of an async call waits for it when destroyed, which is then only until the next recursion level
+    cancelled = true;
+}
+
+bool ApproximateHull::pollRefinement()
+{
+    // a deferred refinement is computed by taking it
+    if (refinement.valid() && refinement.wait_for(std::chrono::seconds(0)) != std::future_status::timeout)
+    {
+        exactHull = refinement.get();
+        refined = true;
+    }
+    return refined;
+}
+
+void ApproximateHull::drawPolygon(const std::vector<Vector2> &polygon, Color lineColor, Color pointColor)
+{
+    for (int i = 0; i < static_cast<int>(polygon.size()); i++)
+    {
+        if (polygon.size() > 1)
+            DrawLineEx(polygon[i], polygon[(i + 1) % polygon.size()], 2, lineColor);
+        DrawCircleV(polygon[i], 5, pointColor);
+    }
+}
+
+void ApproximateHull::drawCandidates(int lastStrip)
+{
+    for (int index : sideExtremes)
+    {
+        DrawCircleV(points[index], 5, ORANGE);
+    }
+    for (int strip = 0; strip <= lastStrip; strip++)
+    {
+        if (stripLow[strip] == -1)
+            continue;
+        DrawCircleV(points[stripLow[strip]], 5, ORANGE);
+        DrawCircleV(points[stripHigh[strip]], 5, ORANGE);
+    }
+}
+
+void ApproximateHull::draw()
+{
+    const ApproximateHullStep &step = steps[currentStep];
+
+    if (step.type == FINISH)
+    {
+        // the exact hull replaces the approximate one once it is ready
+        if (pollRefinement())
+        {
+            drawPolygon(hull, GREEN, BLUE);
+            drawPolygon(exactHull, DARKBLUE, BLUE);
+            GuiLabel({10, 60, 400, 30}, "Refined to the exact convex hull");
+        }
+        else
+        {
+            drawPolygon(hull, GREEN, BLUE);
+            GuiLabel({10, 60, 400, 30}, TextFormat("Error at most %.1f%s", getErrorBound(),
+                                                   refinement.valid() ? ", refining..." : ""));
+        }
+        return;
+    }
+
+    float top = 0, bottom = GetScreenHeight();
+    for (int strip = 0; strip <= stripCount; strip++)
+    {
+        DrawLineV({stripLeft(strip), top}, {stripLeft(strip), bottom}, LIGHTGRAY);
+    }
+    if (step.type == RANGE)
+        return;
+
+    if (step.type == HULL)
+    {
+        drawCandidates(stripCount - 1);
+        drawPolygon(hull, GREEN, BLUE);
+        return;
+    }
+
+    DrawRectangleV({stripLeft(step.strip), top}, {stripWidth, bottom - top}, Fade(SKYBLUE, 0.3f));
+    drawCandidates(step.strip);
+    DrawCircleV(points[stripLow[step.strip]], 5, PURPLE);
+    DrawCircleV(points[stripHigh[step.strip]], 5, PURPLE);
+}
+
+void ApproximateHull::next()
+{
+    if (currentStep < static_cast<int>(steps.size()) - 1)
+        currentStep++;
+}
+
+void ApproximateHull::previous()
+{
+    if (currentStep > 0)
+        currentStep--;
+}
+
+bool ApproximateHull::isFinished()
+{
+    return currentStep >= static_cast<int>(steps.size()) - 1;
+}
+
+int ApproximateHull::getNumberOfSteps()
+{
+    return steps.size();
+}
+
+int ApproximateHull::getCurrentStep()
+{
+    return currentStep;
+}
+
+void ApproximateHull::setCurrentStep(int step)
+{
+    currentStep = step;
+}
+
+std::vector<Vector2> ApproximateHull::exportHull()
+{
+    if (pollRefinement())
+        return exactHull;
+    return hull;
+}
+
+void ApproximateHull::showLegend(bool *showLegend, Vector2 *windowPosition, Vector2 *windowSize,
+                                 Vector2 *maxWindowSize, Vector2 *contentSize, Vector2 *scroll, bool *moving,
+                                 bool *resizing, bool *minimized, float toolbarHeight, float bottomBarHeight,
+                                 const char *title)
+{
+    float statusBarHeight = 24.0f, closeButtonSize = 18.0f;
+    if (*showLegend)
+    {
+        int closeTitleSizeDeltaHalf = (statusBarHeight - closeButtonSize) / 2;
+
+        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && !(*moving) && !(*resizing))
+        {
+            Vector2 mousePosition = GetMousePosition();
+
+            Rectangle titleCollisionRect = {(*windowPosition).x, (*windowPosition).y,
+                                            (*windowSize).x - (closeButtonSize + closeTitleSizeDeltaHalf),
+                                            statusBarHeight};
+            Rectangle resizeCollisionRect = {(*windowPosition).x + (*windowSize).x - 20.0f,
+                                             (*windowPosition).y + (*windowSize).y - 20.0f, 20.0f, 20.0f};
+
+            if (CheckCollisionPointRec(mousePosition, titleCollisionRect))
+            {
+                (*moving) = true;
+            }
+            else if (!(*minimized) && CheckCollisionPointRec(mousePosition, resizeCollisionRect))
+            {
+                (*resizing) = true;
+            }
+        }
+
+        if ((*moving))
+        {
+            Vector2 mouseDelta = GetMouseDelta();
+            (*windowPosition).x += mouseDelta.x;
+            (*windowPosition).y += mouseDelta.y;
+
+            if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
+            {
+                (*moving) = false;
+
+                if ((*windowPosition).x < 0.0f)
+                    (*windowPosition).x = 10.0f;
+                else if ((*windowPosition).x > GetScreenWidth() - (*windowSize).x)
+                    (*windowPosition).x = GetScreenWidth() - (*windowSize).x - 10.0f;
+                if ((*windowPosition).y < toolbarHeight)
+                    (*windowPosition).y = toolbarHeight + 10;
+                else if ((*windowPosition).y > GetScreenHeight() - toolbarHeight - bottomBarHeight)
+                    (*windowPosition).y = GetScreenHeight() - bottomBarHeight - statusBarHeight - 10.0f;
+            }
+        }
+        else if ((*resizing))
+        {
+            Vector2 mouseDelta = GetMouseDelta();
+            (*windowSize).x += mouseDelta.x;
+            (*windowSize).y += mouseDelta.y;
+
+            if ((*windowSize).x < 100.0f)
+                (*windowSize).x = 100.0f;
+            else if ((*windowSize).x > GetScreenWidth() - 10.0f)
+                (*windowSize).x = GetScreenWidth() - 10.0f;
+            if ((*windowSize).y < 100.0f)
+                (*windowSize).y = 100.0f;
+            else if ((*windowSize).y > GetScreenHeight() - toolbarHeight - bottomBarHeight - 10.0f)
+                (*windowSize).y = GetScreenHeight() - toolbarHeight - bottomBarHeight - 10.0f;
+
+            if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
+            {
+                (*resizing) = false;
+            }
+        }
+
+        if ((*minimized))
+        {
+            GuiStatusBar((Rectangle){(*windowPosition).x, (*windowPosition).y, (*windowSize).x, statusBarHeight},
+                         title);
+
+            if (GuiButton((Rectangle){(*windowPosition).x + (*windowSize).x - closeButtonSize - closeTitleSizeDeltaHalf,
+                                      (*windowPosition).y + closeTitleSizeDeltaHalf, closeButtonSize, closeButtonSize},
+                          "#120#"))
+            {
+                (*minimized) = false;
+                (*windowSize) = (*maxWindowSize);
+            }
+        }
+        else
+        {
+            (*minimized) = GuiWindowBox(
+                (Rectangle){(*windowPosition).x, (*windowPosition).y, (*windowSize).x, (*windowSize).y}, title);
+            if ((*minimized))
+            {
+                (*windowSize) = {(*maxWindowSize).x, statusBarHeight};
+            }
+
+            Rectangle scissor = {0};
+            GuiScrollPanel((Rectangle){(*windowPosition).x, (*windowPosition).y + statusBarHeight, (*windowSize).x,
+                                       (*windowSize).y - statusBarHeight},
+                           NULL, (Rectangle){(*windowPosition).x, (*windowSize).y, (*contentSize).x, (*contentSize).y},
+                           scroll, &scissor);
+
+            bool requireScissor = (*windowSize).x < (*contentSize).x || (*windowSize).y < (*contentSize).y;
+
+            if (requireScissor)
+            {
+                BeginScissorMode(scissor.x, scissor.y, scissor.width, scissor.height);
+            }
+
+            DrawCircleV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 50.0f + (*scroll).y}, 5,
+                        BLUE);
+            GuiLabel(
+                {(*windowPosition).x + 30.0f + (*scroll).x, (*windowPosition).y + 35.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Convex Hull Point");
+
+            DrawCircleV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 75.0f + (*scroll).y}, 5,
+                        ORANGE);
+            GuiLabel(
+                {(*windowPosition).x + 30.0f + (*scroll).x, (*windowPosition).y + 60.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Lowest or Highest Point of a Strip");
+
+            DrawCircleV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 100.0f + (*scroll).y}, 5,
+                        PURPLE);
+            GuiLabel(
+                {(*windowPosition).x + 30.0f + (*scroll).x, (*windowPosition).y + 85.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Points of the Current Strip");
+
+            DrawLineV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 125.0f + (*scroll).y},
+                      {(*windowPosition).x + 80.0f + (*scroll).x, (*windowPosition).y + 125.0f + (*scroll).y}, GREEN);
+            GuiLabel(
+                {(*windowPosition).x + 90.0f + (*scroll).x, (*windowPosition).y + 110.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Approximate Convex Hull Line");
+
+            DrawLineV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 150.0f + (*scroll).y},
+                      {(*windowPosition).x + 80.0f + (*scroll).x, (*windowPosition).y + 150.0f + (*scroll).y},
+                      DARKBLUE);
+            GuiLabel(
+                {(*windowPosition).x + 90.0f + (*scroll).x, (*windowPosition).y + 135.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Exact Convex Hull Line");
+
+            DrawLineV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 175.0f + (*scroll).y},
+                      {(*windowPosition).x + 80.0f + (*scroll).x, (*windowPosition).y + 175.0f + (*scroll).y},
+                      LIGHTGRAY);
+            GuiLabel(
+                {(*windowPosition).x + 90.0f + (*scroll).x, (*windowPosition).y + 160.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Strip Boundary");
+
+            if (requireScissor)
+            {
+                EndScissorMode();
+            }
+
+            GuiDrawIcon(71, (*windowPosition).x + (*windowSize).x - 20, (*windowPosition).y + (*windowSize).y - 20, 1,
+                        WHITE);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+/**
+ * @file approximate_hull_engine.cpp
+ * @brief Contains the implementation of the ApproximateHullEngine class template.
+ *
+ */
+#include "approximate_hull_engine.h"
+#include "monotone_chain_engine.h"
+#include "task_scheduler.h"
+#include <algorithm>
+
+template <typename Recording>
+ApproximateHullEngine<Recording>::ApproximateHullEngine(std::vector<Vector2> p, int stripCount)
+    : stripCount(std::max(1, stripCount))
+{
+    points = std::move(p);
+
+    if (points.size() != 0)
+        computeConvexHull();
+}
+
+template <typename Recording> const std::vector<Vector2> &ApproximateHullEngine<Recording>::getConvexHull() const
+{
+    return hull;
+}
+
+template <typename Recording> float ApproximateHullEngine<Recording>::getErrorBound() const
+{
+    return stripWidth;
+}
+
+template <typename Recording> int ApproximateHullEngine<Recording>::stripOf(Vector2 p) const
+{
+    return std::min(stripCount - 1, static_cast<int>((p.x - minX) * stripScale));
+}
+
+template <typename Recording> float ApproximateHullEngine<Recording>::stripLeft(int strip) const
+{
+    return minX + strip * stripWidth;
+}
+
+template <typename Recording> void ApproximateHullEngine<Recording>::findRange()
+{
+    // the loop has no data dependent branches, so the compiler can vectorize it
+    int chunkCount = (points.size() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    std::vector<float> chunkMin(chunkCount), chunkMax(chunkCount);
+    TaskScheduler::shared().parallelFor(0, chunkCount, [&](int chunk) {
+        int begin = chunk * CHUNK_SIZE, end = std::min<int>(points.size(), begin + CHUNK_SIZE);
+        float low = points[begin].x, high = points[begin].x;
+        for (int i = begin + 1; i < end; i++)
+        {
+            low = std::min(low, points[i].x);
+            high = std::max(high, points[i].x);
+        }
+        chunkMin[chunk] = low;
+        chunkMax[chunk] = high;
+    });
+
+    minX = *std::min_element(chunkMin.begin(), chunkMin.end());
+    maxX = *std::max_element(chunkMax.begin(), chunkMax.end());
+    stripWidth = (maxX - minX) / stripCount;
+    stripScale = stripWidth > 0 ? 1 / stripWidth : 0;
+}
+
+template <typename Recording> void ApproximateHullEngine<Recording>::findStripExtremes()
+{
+    // every chunk keeps the extremes of all the strips and of both sides, and the chunks are merged in chunk order so
+    // that the first point wins a tie
+    auto update = [this](int &low, int &high, int i) {
+        if (low == -1 || points[i].y < points[low].y)
+            low = i;
+        if (high == -1 || points[i].y > points[high].y)
+            high = i;
+    };
+    int chunkCount = (points.size() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    std::vector<int> chunkLow(chunkCount * stripCount, -1), chunkHigh(chunkCount * stripCount, -1);
+    std::vector<int> chunkSides(chunkCount * 4, -1);
+    TaskScheduler::shared().parallelFor(0, chunkCount, [&](int chunk) {
+        int begin = chunk * CHUNK_SIZE, end = std::min<int>(points.size(), begin + CHUNK_SIZE);
+        int *low = &chunkLow[chunk * stripCount], *high = &chunkHigh[chunk * stripCount];
+        int *sides = &chunkSides[chunk * 4];
+        for (int i = begin; i < end; i++)
+        {
+            int strip = stripOf(points[i]);
+            update(low[strip], high[strip], i);
+            if (points[i].x == minX)
+                update(sides[0], sides[1], i);
+            if (points[i].x == maxX)
+                update(sides[2], sides[3], i);
+        }
+    });
+
+    stripLow.assign(stripCount, -1);
+    stripHigh.assign(stripCount, -1);
+    for (int chunk = 0; chunk < chunkCount; chunk++)
+    {
+        for (int strip = 0; strip < stripCount; strip++)
+        {
+            if (chunkLow[chunk * stripCount + strip] == -1)
+                continue;
+            update(stripLow[strip], stripHigh[strip], chunkLow[chunk * stripCount + strip]);
+            update(stripLow[strip], stripHigh[strip], chunkHigh[chunk * stripCount + strip]);
+        }
+        for (int side = 0; side < 4; side += 2)
+        {
+            if (chunkSides[chunk * 4 + side] == -1)
+                continue;
+            update(sideExtremes[side], sideExtremes[side + 1], chunkSides[chunk * 4 + side]);
+            update(sideExtremes[side], sideExtremes[side + 1], chunkSides[chunk * 4 + side + 1]);
+        }
+    }
+}
+
+template <typename Recording> void ApproximateHullEngine<Recording>::computeConvexHull()
+{
+    findRange();
+    if constexpr (Recording::enabled)
+        steps.push_back({RANGE, -1});
+
+    findStripExtremes();
+    std::vector<Vector2> candidates;
+    for (int index : sideExtremes)
+        candidates.push_back(points[index]);
+    for (int strip = 0; strip < stripCount; strip++)
+    {
+        if (stripLow[strip] == -1)
+            continue;
+        candidates.push_back(points[stripLow[strip]]);
+        if (stripHigh[strip] != stripLow[strip])
+            candidates.push_back(points[stripHigh[strip]]);
+        if constexpr (Recording::enabled)
+            steps.push_back({STRIP, strip});
+    }
+
+    hull = MonotoneChainEngine<NoRecord>(std::move(candidates)).getConvexHull();
+    if constexpr (Recording::enabled)
+    {
+        steps.push_back({HULL, -1});
+        steps.push_back({FINISH, -1});
+    }
+}
+
+template class ApproximateHullEngine<Record>;
+template class ApproximateHullEngine<NoRecord>;
\ No newline at end of file
@@ -0,0 +1,142 @@
+/**
+ * @file batch_hull.cpp
+ * @brief Contains the implementation of the BatchHull class.
+ *
+ */
+#include "batch_hull.h"
+#include "task_scheduler.h"
+#include <algorithm>
+
+BatchHull::BatchHull(int grainSize) : grainSize(std::max(1, grainSize))
+{
+}
+
+void BatchHull::compute(const float *xs, const float *ys, const int *offsets, int setCount)
+{
+    hullOffsets.assign(setCount + 1, 0);
+    indices.clear();
+    if (setCount <= 0)
+        return;
+
+    // a chunk is closed once it holds grainSize points, so that a task is worth handing to a worker
+    std::vector<int> chunkStarts = {0};
+    int chunkPoints = 0;
+    for (int set = 0; set < setCount - 1; set++)
+    {
+        chunkPoints += offsets[set + 1] - offsets[set];
+        if (chunkPoints >= grainSize)
+        {
+            chunkStarts.push_back(set + 1);
+            chunkPoints = 0;
+        }
+    }
+    chunkStarts.push_back(setCount);
+
+    // a hull has no more points than its set, so every set writes its hull where its points are in the input and the
+    // hulls are packed together afterwards
+    int first = offsets[0];
+    indices.resize(offsets[setCount] - first);
+    std::vector<int> counts(setCount);
+    TaskScheduler::shared().parallelFor(0, chunkStarts.size() - 1, [&](int chunk) {
+        Scratch scratch;
+        for (int set = chunkStarts[chunk]; set < chunkStarts[chunk + 1]; set++)
+        {
+            int begin = offsets[set], n = offsets[set + 1] - begin;
+            int *out = indices.data() + (begin - first);
+            counts[set] = n <= SMALL_SET_SIZE ? smallHull(xs, ys, begin, n, out)
+                                              : largeHull(xs, ys, begin, n, scratch, out);
+        }
+    });
+
+    int size = 0;
+    for (int set = 0; set < setCount; set++)
+    {
+        int *hull = indices.data() + (offsets[set] - first);
+        std::copy(hull, hull + counts[set], indices.data() + size);
+        hullOffsets[set] = size;
+        size += counts[set];
+    }
+    hullOffsets[setCount] = size;
+    indices.resize(size);
+}
+
+const std::vector<int> &BatchHull::getIndices() const
+{
+    return indices;
+}
+
+const std::vector<int> &BatchHull::getHullOffsets() const
+{
+    return hullOffsets;
+}
+
+bool BatchHull::compareIndexedPoint(const IndexedPoint &a, const IndexedPoint &b)
+{
+    if (a.x == b.x)
+        return a.y < b.y;
+    return a.x < b.x;
+}
+
+float BatchHull::cross(float ox, float oy, float ax, float ay, float bx, float by)
+{
+    return (ax - ox) * (by - oy) - (ay - oy) * (bx - ox);
+}
+
+int BatchHull::chain(const IndexedPoint *points, int n, int *lower, int *out)
+{
+    // the chains hold positions in the sorted points, the upper one being built in the output itself, and turn the
+    // same way as in MonotoneChainEngine so that both give the same hulls
+    auto turn = [points](int o, int a, int b) {
+        return cross(points[o].x, points[o].y, points[a].x, points[a].y, points[b].x, points[b].y);
+    };
+    int upperCount = 0, lowerCount = 0;
+    for (int i = 0; i < n; i++)
+    {
+        if (i > 0 && points[i].x == points[i - 1].x && points[i].y == points[i - 1].y)
+            continue;
+
+        while (upperCount >= 2 && turn(out[upperCount - 2], out[upperCount - 1], i) >= 0)
+            upperCount--;
+        out[upperCount++] = i;
+
+        while (lowerCount >= 2 && turn(lower[lowerCount - 2], lower[lowerCount - 1], i) <= 0)
+            lowerCount--;
+        lower[lowerCount++] = i;
+    }
+
+    // the chains share their first and last points, which are only taken from the upper chain
+    for (int i = 0; i < upperCount; i++)
+        out[i] = points[out[i]].index;
+    int count = upperCount;
+    for (int i = lowerCount - 2; i > 0; i--)
+        out[count++] = points[lower[i]].index;
+    return count;
+}
+
+int BatchHull::smallHull(const float *xs, const float *ys, int begin, int n, int *out)
+{
+    IndexedPoint points[SMALL_SET_SIZE];
+    int lower[SMALL_SET_SIZE];
+    for (int i = 0; i < n; i++)
+    {
+        IndexedPoint p = {xs[begin + i], ys[begin + i], begin + i};
+        int j = i;
+        while (j > 0 && compareIndexedPoint(p, points[j - 1]))
+        {
+            points[j] = points[j - 1];
+            j--;
+        }
+        points[j] = p;
+    }
+    return chain(points, n, lower, out);
+}
+
+int BatchHull::largeHull(const float *xs, const float *ys, int begin, int n, Scratch &scratch, int *out)
+{
+    scratch.points.resize(n);
+    scratch.lower.resize(n);
+    for (int i = 0; i < n; i++)
+        scratch.points[i] = {xs[begin + i], ys[begin + i], begin + i};
+    std::sort(scratch.points.begin(), scratch.points.end(), &compareIndexedPoint);
+    return chain(scratch.points.data(), n, scratch.lower.data(), out);
+}
\ No newline at end of file
@@ -0,0 +1,213 @@
+/**
+ * @file binary_point_file.cpp
+ * @brief Contains the implementation of the BinaryPointFile class.
+ *
+ */
+#include "binary_point_file.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+const char BinaryPointFile::MAGIC[4] = {'C', 'H', 'P', 'F'};
+
+BinaryPointFile::BinaryPointFile()
+{
+}
+
+bool BinaryPointFile::isBinaryPointFile(const char *data, size_t size)
+{
+    return size >= sizeof(MAGIC) && std::memcmp(data, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+bool BinaryPointFile::write(const std::string &filePath, const std::vector<Vector2> &points,
+                            const std::vector<Vector2> &hull, std::string &error)
+{
+    Header header = {};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.count = points.size();
+    header.coordinateType = FLOAT32;
+    if (!points.empty())
+    {
+        header.bounds[0] = header.bounds[2] = points[0].x;
+        header.bounds[1] = header.bounds[3] = points[0].y;
+    }
+    for (const Vector2 &p : points)
+    {
+        header.bounds[0] = std::min<double>(header.bounds[0], p.x);
+        header.bounds[1] = std::min<double>(header.bounds[1], p.y);
+        header.bounds[2] = std::max<double>(header.bounds[2], p.x);
+        header.bounds[3] = std::max<double>(header.bounds[3], p.y);
+    }
+    if (!hull.empty())
+    {
+        header.hullOffset = HEADER_SIZE + 2 * sizeof(float) * header.count;
+        header.hullCount = hull.size();
+    }
+
+    std::ofstream ostream(filePath, std::ios::binary | std::ios::trunc);
+    ostream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    // every block is gathered from the points a piece at a time
+    std::vector<float> block(std::min<size_t>(std::max(points.size(), hull.size()), 1 << 16));
+    for (const std::vector<Vector2> *source : {&points, &hull})
+    {
+        for (float Vector2::*coordinate : {&Vector2::x, &Vector2::y})
+        {
+            for (size_t begin = 0; begin < source->size(); begin += block.size())
+            {
+                size_t count = std::min(block.size(), source->size() - begin);
+                for (size_t i = 0; i < count; i++)
+                    block[i] = (*source)[begin + i].*coordinate;
+                ostream.write(reinterpret_cast<const char *>(block.data()), count * sizeof(float));
+            }
+        }
+    }
+
+    ostream.close();
+    if (!ostream)
+    {
+        error = filePath + ": could not write the file";
+        return false;
+    }
+    return true;
+}
+
+bool BinaryPointFile::fail(const char *reason)
+{
+    error = path + ": " + reason;
+    close();
+    return false;
+}
+
+bool BinaryPointFile::open(const std::string &filePath)
+{
+    path = filePath;
+    error.clear();
+    header = {};
+    if (!file.open(filePath))
+        return fail("could not open the file");
+    return readHeader();
+}
+
+bool BinaryPointFile::open(const std::string &filePath, MappedFile &contents)
+{
+    path = filePath;
+    error.clear();
+    header = {};
+    file.close();
+    file.swap(contents);
+    return readHeader();
+}
+
+bool BinaryPointFile::readHeader()
+{
+    if (file.getSize() < HEADER_SIZE)
+        return fail("too small for the header of a binary point file");
+    std::memcpy(&header, file.getData(), sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0)
+        return fail("not a binary point file");
+    if (header.version != VERSION)
+        return fail("unsupported version of the binary point format");
+    if (header.coordinateType != FLOAT32 && header.coordinateType != FLOAT64)
+        return fail("unknown co-ordinate type");
+
+    // the sizes are checked by division so that a corrupt count cannot overflow
+    uint64_t size = header.coordinateType == FLOAT32 ? sizeof(float) : sizeof(double);
+    uint64_t room = (file.getSize() - HEADER_SIZE) / (2 * size);
+    if (header.count > room)
+        return fail("the file is shorter than its points");
+    if (header.hullOffset != 0)
+    {
+        if (header.hullOffset < HEADER_SIZE + 2 * size * header.count || header.hullOffset % size != 0 ||
+            header.hullOffset > file.getSize() || header.hullCount > (file.getSize() - header.hullOffset) / (2 * size))
+            return fail("the precomputed hull lies outside the file");
+    }
+    return true;
+}
+
+void BinaryPointFile::close()
+{
+    file.close();
+    header = {};
+}
+
+size_t BinaryPointFile::getSize() const
+{
+    return file.getSize();
+}
+
+long long BinaryPointFile::getCount() const
+{
+    return header.count;
+}
+
+BinaryPointFile::CoordinateType BinaryPointFile::getCoordinateType() const
+{
+    return static_cast<CoordinateType>(header.coordinateType);
+}
+
+Vector2 BinaryPointFile::getMin() const
+{
+    return {static_cast<float>(header.bounds[0]), static_cast<float>(header.bounds[1])};
+}
+
+Vector2 BinaryPointFile::getMax() const
+{
+    return {static_cast<float>(header.bounds[2]), static_cast<float>(header.bounds[3])};
+}
+
+const float *BinaryPointFile::getXs() const
+{
+    if (header.coordinateType != FLOAT32)
+        return nullptr;
+    return reinterpret_cast<const float *>(file.getData() + HEADER_SIZE);
+}
+
+const float *BinaryPointFile::getYs() const
+{
+    if (header.coordinateType != FLOAT32)
+        return nullptr;
+    return getXs() + header.count;
+}
+
+void BinaryPointFile::copyPoints(uint64_t offset, uint64_t blockCount, long long first, int count,
+                                 Vector2 *out) const
+{
+    if (header.coordinateType == FLOAT32)
+    {
+        const float *xs = reinterpret_cast<const float *>(file.getData() + offset) + first;
+        const float *ys = xs + blockCount;
+        for (int i = 0; i < count; i++)
+            out[i] = {xs[i], ys[i]};
+    }
+    else
+    {
+        const double *xs = reinterpret_cast<const double *>(file.getData() + offset) + first;
+        const double *ys = xs + blockCount;
+        for (int i = 0; i < count; i++)
+            out[i] = {static_cast<float>(xs[i]), static_cast<float>(ys[i])};
+    }
+}
+
+void BinaryPointFile::readPoints(long long first, int count, Vector2 *out) const
+{
+    copyPoints(HEADER_SIZE, header.count, first, count, out);
+}
+
+bool BinaryPointFile::hasHull() const
+{
+    return header.hullOffset != 0;
+}
+
+std::vector<Vector2> BinaryPointFile::getHull() const
+{
+    std::vector<Vector2> hull(hasHull() ? header.hullCount : 0);
+    copyPoints(header.hullOffset, hull.size(), 0, hull.size(), hull.data());
+    return hull;
+}
+
+const std::string &BinaryPointFile::getError() const
+{
+    return error;
+}
\ No newline at end of file
@@ -0,0 +1,252 @@
+/**
+ * @file chan.cpp
+ * @brief Contains the implementation of the Chan class.
+ *
+ */
+#include "chan.h"
+#include "raygui.h"
+
+Chan::Chan(std::vector<Vector2> p) : ChanEngine<Record>(std::move(p))
+{
+}
+
+Chan::~Chan()
+{
+}
+
+void Chan::drawPolygon(const Vector2 *polygon, int count, Color lineColor, Color pointColor)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (count > 1)
+            DrawLineEx(polygon[i], polygon[(i + 1) % count], 2, lineColor);
+        DrawCircleV(polygon[i], 5, pointColor);
+    }
+}
+
+void Chan::draw()
+{
+    ChanStep step = steps[currentStep];
+    const ChanGuess &guess = guesses[step.guess];
+    GuiLabel({220, 10, 200, 30}, TextFormat("m = %d", guess.groupSize));
+
+    if (step.type == FINISH)
+    {
+        // draw the entire hull
+        drawPolygon(hull.data(), hull.size(), GREEN, BLUE);
+        return;
+    }
+
+    for (int group = 0; group < static_cast<int>(guess.hullBegin.size()); group++)
+    {
+        Color color = (step.type == TANGENT && step.group == group) ? ORANGE : SKYBLUE;
+        drawPolygon(guess.groupHulls.data() + guess.hullBegin[group], guess.hullSize[group], color, color);
+    }
+
+    // the hull wrapped so far, red when it did not close within m points
+    Color wrapColor = step.type == GUESS_FAILED ? RED : GREEN;
+    for (int i = 1; i < step.wrapLength; i++)
+    {
+        DrawLineEx(guess.wrap[i - 1], guess.wrap[i], 2, wrapColor);
+    }
+    for (int i = 0; i < step.wrapLength; i++)
+    {
+        DrawCircleV(guess.wrap[i], 5, BLUE);
+    }
+
+    if (step.type == TANGENT)
+    {
+        DrawLineV(step.current, step.tangent, ORANGE);
+        DrawLineV(step.current, step.best, RED);
+        DrawCircleV(step.tangent, 5, PURPLE);
+    }
+}
+
+void Chan::next()
+{
+    if (currentStep < static_cast<int>(steps.size()) - 1)
+        currentStep++;
+}
+
+void Chan::previous()
+{
+    if (currentStep > 0)
+        currentStep--;
+}
+
+bool Chan::isFinished()
+{
+    return currentStep >= static_cast<int>(steps.size()) - 1;
+}
+
+int Chan::getNumberOfSteps()
+{
+    return steps.size();
+}
+
+int Chan::getCurrentStep()
+{
+    return currentStep;
+}
+
+void Chan::setCurrentStep(int step)
+{
+    currentStep = step;
+}
+
+std::vector<Vector2> Chan::exportHull()
+{
+    return hull;
+}
+
+void Chan::showLegend(bool *showLegend, Vector2 *windowPosition, Vector2 *windowSize, Vector2 *maxWindowSize,
+                      Vector2 *contentSize, Vector2 *scroll, bool *moving, bool *resizing, bool *minimized,
+                      float toolbarHeight, float bottomBarHeight, const char *title)
+{
+    float statusBarHeight = 24.0f, closeButtonSize = 18.0f;
+    if (*showLegend)
+    {
+        int closeTitleSizeDeltaHalf = (statusBarHeight - closeButtonSize) / 2;
+
+        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && !(*moving) && !(*resizing))
+        {
+            Vector2 mousePosition = GetMousePosition();
+
+            Rectangle titleCollisionRect = {(*windowPosition).x, (*windowPosition).y,
+                                            (*windowSize).x - (closeButtonSize + closeTitleSizeDeltaHalf),
+                                            statusBarHeight};
+            Rectangle resizeCollisionRect = {(*windowPosition).x + (*windowSize).x - 20.0f,
+                                             (*windowPosition).y + (*windowSize).y - 20.0f, 20.0f, 20.0f};
+
+            if (CheckCollisionPointRec(mousePosition, titleCollisionRect))
+            {
+                (*moving) = true;
+            }
+            else if (!(*minimized) && CheckCollisionPointRec(mousePosition, resizeCollisionRect))
+            {
+                (*resizing) = true;
+            }
+        }
+
+        if ((*moving))
+        {
+            Vector2 mouseDelta = GetMouseDelta();
+            (*windowPosition).x += mouseDelta.x;
+            (*windowPosition).y += mouseDelta.y;
+
+            if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
+            {
+                (*moving) = false;
+
+                if ((*windowPosition).x < 0.0f)
+                    (*windowPosition).x = 10.0f;
+                else if ((*windowPosition).x > GetScreenWidth() - (*windowSize).x)
+                    (*windowPosition).x = GetScreenWidth() - (*windowSize).x - 10.0f;
+                if ((*windowPosition).y < toolbarHeight)
+                    (*windowPosition).y = toolbarHeight + 10;
+                else if ((*windowPosition).y > GetScreenHeight() - toolbarHeight - bottomBarHeight)
+                    (*windowPosition).y = GetScreenHeight() - bottomBarHeight - statusBarHeight - 10.0f;
+            }
+        }
+        else if ((*resizing))
+        {
+            Vector2 mouseDelta = GetMouseDelta();
+            (*windowSize).x += mouseDelta.x;
+            (*windowSize).y += mouseDelta.y;
+
+            if ((*windowSize).x < 100.0f)
+                (*windowSize).x = 100.0f;
+            else if ((*windowSize).x > GetScreenWidth() - 10.0f)
+                (*windowSize).x = GetScreenWidth() - 10.0f;
+            if ((*windowSize).y < 100.0f)
+                (*windowSize).y = 100.0f;
+            else if ((*windowSize).y > GetScreenHeight() - toolbarHeight - bottomBarHeight - 10.0f)
+                (*windowSize).y = GetScreenHeight() - toolbarHeight - bottomBarHeight - 10.0f;
+
+            if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
+            {
+                (*resizing) = false;
+            }
+        }
+
+        if ((*minimized))
+        {
+            GuiStatusBar((Rectangle){(*windowPosition).x, (*windowPosition).y, (*windowSize).x, statusBarHeight},
+                         title);
+
+            if (GuiButton((Rectangle){(*windowPosition).x + (*windowSize).x - closeButtonSize - closeTitleSizeDeltaHalf,
+                                      (*windowPosition).y + closeTitleSizeDeltaHalf, closeButtonSize, closeButtonSize},
+                          "#120#"))
+            {
+                (*minimized) = false;
+                (*windowSize) = (*maxWindowSize);
+            }
+        }
+        else
+        {
+            (*minimized) = GuiWindowBox(
+                (Rectangle){(*windowPosition).x, (*windowPosition).y, (*windowSize).x, (*windowSize).y}, title);
+            if ((*minimized))
+            {
+                (*windowSize) = {(*maxWindowSize).x, statusBarHeight};
+            }
+
+            Rectangle scissor = {0};
+            GuiScrollPanel((Rectangle){(*windowPosition).x, (*windowPosition).y + statusBarHeight, (*windowSize).x,
+                                       (*windowSize).y - statusBarHeight},
+                           NULL, (Rectangle){(*windowPosition).x, (*windowSize).y, (*contentSize).x, (*contentSize).y},
+                           scroll, &scissor);
+
+            bool requireScissor = (*windowSize).x < (*contentSize).x || (*windowSize).y < (*contentSize).y;
+
+            if (requireScissor)
+            {
+                BeginScissorMode(scissor.x, scissor.y, scissor.width, scissor.height);
+            }
+
+            DrawCircleV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 50.0f + (*scroll).y}, 5,
+                        BLUE);
+            GuiLabel(
+                {(*windowPosition).x + 30.0f + (*scroll).x, (*windowPosition).y + 35.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Convex Hull Point");
+
+            DrawCircleV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 75.0f + (*scroll).y}, 5,
+                        PURPLE);
+            GuiLabel(
+                {(*windowPosition).x + 30.0f + (*scroll).x, (*windowPosition).y + 60.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Tangent Point");
+
+            DrawLineV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 100.0f + (*scroll).y},
+                      {(*windowPosition).x + 80.0f + (*scroll).x, (*windowPosition).y + 100.0f + (*scroll).y}, GREEN);
+            GuiLabel(
+                {(*windowPosition).x + 90.0f + (*scroll).x, (*windowPosition).y + 85.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Convex Hull Line");
+
+            DrawLineV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 125.0f + (*scroll).y},
+                      {(*windowPosition).x + 80.0f + (*scroll).x, (*windowPosition).y + 125.0f + (*scroll).y}, SKYBLUE);
+            GuiLabel(
+                {(*windowPosition).x + 90.0f + (*scroll).x, (*windowPosition).y + 110.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Mini Hull Line");
+
+            DrawLineV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 150.0f + (*scroll).y},
+                      {(*windowPosition).x + 80.0f + (*scroll).x, (*windowPosition).y + 150.0f + (*scroll).y}, ORANGE);
+            GuiLabel(
+                {(*windowPosition).x + 90.0f + (*scroll).x, (*windowPosition).y + 135.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Tangent Line");
+
+            DrawLineV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 175.0f + (*scroll).y},
+                      {(*windowPosition).x + 80.0f + (*scroll).x, (*windowPosition).y + 175.0f + (*scroll).y}, RED);
+            GuiLabel(
+                {(*windowPosition).x + 90.0f + (*scroll).x, (*windowPosition).y + 160.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Best Tangent Line");
+
+            if (requireScissor)
+            {
+                EndScissorMode();
+            }
+
+            GuiDrawIcon(71, (*windowPosition).x + (*windowSize).x - 20, (*windowPosition).y + (*windowSize).y - 20, 1,
+                        WHITE);
+        }
+    }
+}
\ No newline at end of file
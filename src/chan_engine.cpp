@@ -0,0 +1,257 @@
+/**
+ * @file chan_engine.cpp
+ * @brief Contains the implementation of the ChanEngine class template.
+ *
+ */
+#include "chan_engine.h"
+#include <algorithm>
+
+template <typename Recording>
+ChanEngine<Recording>::ChanEngine(std::vector<Vector2> p, int grainSize) : grainSize(std::max(1, grainSize))
+{
+    points = std::move(p);
+
+    if (points.size() != 0)
+        computeConvexHull();
+}
+
+template <typename Recording> const std::vector<Vector2> &ChanEngine<Recording>::getConvexHull() const
+{
+    return hull;
+}
+
+template <typename Recording> int ChanEngine<Recording>::getGroupSize() const
+{
+    return groupSize;
+}
+
+template <typename Recording> long long ChanEngine<Recording>::getTangentProbes() const
+{
+    return tangentProbes;
+}
+
+template <typename Recording> bool ChanEngine<Recording>::compareVector2(Vector2 a, Vector2 b)
+{
+    if (a.x == b.x)
+        return a.y < b.y;
+    return a.x < b.x;
+}
+
+template <typename Recording> float ChanEngine<Recording>::cross(Vector2 o, Vector2 a, Vector2 b)
+{
+    return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+}
+
+template <typename Recording> bool ChanEngine<Recording>::isBetter(Vector2 p, Vector2 best, Vector2 candidate)
+{
+    float turn = cross(p, best, candidate);
+    if (turn != 0)
+        return turn > 0;
+    float bestX = best.x - p.x, bestY = best.y - p.y;
+    float candidateX = candidate.x - p.x, candidateY = candidate.y - p.y;
+    return candidateX * candidateX + candidateY * candidateY > bestX * bestX + bestY * bestY;
+}
+
+template <typename Recording> int ChanEngine<Recording>::miniHull(Vector2 *S, int n, Vector2 *out, Vector2 *scratch)
+{
+    std::sort(S, S + n, &compareVector2);
+
+    // the upper chain is built in out and the lower chain in scratch, after which the inner points of the lower chain
+    // are appended to the upper chain in reverse
+    int upperCount = 0, lowerCount = 0;
+    for (int i = 0; i < n; i++)
+    {
+        Vector2 p = S[i];
+        if (i > 0 && p.x == S[i - 1].x && p.y == S[i - 1].y)
+            continue;
+        while (upperCount >= 2 && cross(out[upperCount - 2], out[upperCount - 1], p) >= 0)
+            upperCount--;
+        out[upperCount++] = p;
+        while (lowerCount >= 2 && cross(scratch[lowerCount - 2], scratch[lowerCount - 1], p) <= 0)
+            lowerCount--;
+        scratch[lowerCount++] = p;
+    }
+
+    int count = upperCount;
+    for (int i = lowerCount - 2; i > 0; i--)
+        out[count++] = scratch[i];
+    return count;
+}
+
+template <typename Recording> void ChanEngine<Recording>::computeMiniHulls(int m)
+{
+    // every task computes the mini hulls of a run of whole groups, so small groups are not handed out one by one
+    int n = work.size();
+    int groupCount = (n + m - 1) / m;
+    int groupsPerTask = std::max(1, grainSize / m);
+    int taskCount = (groupCount + groupsPerTask - 1) / groupsPerTask;
+    hullSizes.assign(groupCount, 0);
+    TaskScheduler::shared().parallelFor(0, taskCount, [&](int task) {
+        int last = std::min(groupCount, (task + 1) * groupsPerTask);
+        for (int group = task * groupsPerTask; group < last; group++)
+        {
+            int begin = group * m, count = std::min(n - begin, m);
+            hullSizes[group] =
+                miniHull(work.data() + begin, count, groupHulls.data() + begin, chainScratch.data() + begin);
+        }
+    });
+}
+
+template <typename Recording> int ChanEngine<Recording>::tangent(int group, Vector2 p, int current)
+{
+    const Vector2 *v = groupHulls.data() + group * groupSize;
+    int k = hullSizes[group];
+    tangentProbes++;
+
+    // p is on this mini hull, whose points are in clockwise order, so the next one is the tangent
+    if (current != -1)
+        return k == 1 ? -1 : group * groupSize + (current + 1) % k;
+    if (k == 1)
+        return group * groupSize;
+    if (k == 2)
+        return group * groupSize + (isBetter(p, v[0], v[1]) ? 1 : 0);
+
+    // p is outside the mini hull, so seen from it the points of the mini hull go counter-clockwise up to the tangent,
+    // then clockwise back to the other tangent, and the tangent is found by a binary search for the end of the
+    // counter-clockwise run that starts at or goes through v[0]
+    auto isTangent = [&](int c) {
+        return cross(p, v[c], v[(c + k - 1) % k]) <= 0 && cross(p, v[c], v[(c + 1) % k]) <= 0;
+    };
+    auto turnsLeft = [&](int c) { return cross(p, v[c], v[(c + 1) % k]) > 0; };
+
+    int index = 0;
+    if (!isTangent(0))
+    {
+        // with v[0] not on the tangent, no other point of its run is on the line from p to it, so the points before
+        // the tangent are the ones left of that line and turning left, or right of it or turning left
+        bool firstTurnsLeft = turnsLeft(0);
+        int l = 1, r = k;
+        while (l < r)
+        {
+            int c = (l + r) / 2;
+            float side = cross(p, v[0], v[c]);
+            bool beforeTangent = firstTurnsLeft ? turnsLeft(c) && side > 0 : turnsLeft(c) || side < 0;
+            if (beforeTangent)
+                l = c + 1;
+            else
+                r = c;
+            tangentProbes++;
+        }
+        index = l % k;
+    }
+
+    // a neighbour on the line from p to the tangent and further away is taken instead
+    for (int neighbour : {(index + 1) % k, (index + k - 1) % k})
+    {
+        if (isTangent(neighbour) && isBetter(p, v[index], v[neighbour]))
+            index = neighbour;
+    }
+    return group * groupSize + index;
+}
+
+template <typename Recording> bool ChanEngine<Recording>::wrap(int m)
+{
+    Vector2 start = hull[0], p = start;
+    int groupCount = hullSizes.size();
+
+    // the index of p on every mini hull it is a point of, -1 on the others; the first point is the smallest one of
+    // every group it is in, so it comes first on their mini hulls
+    std::vector<int> current(groupCount, -1), tangents(groupCount);
+    for (int group = 0; group < groupCount; group++)
+    {
+        Vector2 first = groupHulls[group * groupSize];
+        if (first.x == start.x && first.y == start.y)
+            current[group] = 0;
+    }
+
+    for (int count = 0; count < m; count++)
+    {
+        int best = -1;
+        for (int group = 0; group < groupCount; group++)
+        {
+            int t = tangent(group, p, current[group]);
+            tangents[group] = t;
+            if (t != -1 && (best == -1 || isBetter(p, groupHulls[best], groupHulls[t])))
+                best = t;
+            if constexpr (Recording::enabled)
+            {
+                steps.push_back({TANGENT, static_cast<int>(guesses.size()) - 1, group, static_cast<int>(hull.size()),
+                                 p, t == -1 ? p : groupHulls[t], best == -1 ? p : groupHulls[best]});
+            }
+        }
+
+        // every point is equal to the first one
+        if (best == -1)
+            return true;
+        Vector2 q = groupHulls[best];
+        if (q.x == start.x && q.y == start.y)
+            return true;
+        hull.push_back(q);
+        if constexpr (Recording::enabled)
+        {
+            guesses.back().wrap.push_back(q);
+            steps.push_back({WRAP, static_cast<int>(guesses.size()) - 1, -1, static_cast<int>(hull.size()), p, q, q});
+        }
+
+        // q is on a mini hull only if it is the tangent found on it, since no other point of the mini hull is beyond
+        for (int group = 0; group < groupCount; group++)
+        {
+            int t = tangents[group];
+            current[group] = t != -1 && groupHulls[t].x == q.x && groupHulls[t].y == q.y ? t - group * groupSize : -1;
+        }
+        p = q;
+    }
+    return false;
+}
+
+template <typename Recording> void ChanEngine<Recording>::computeConvexHull()
+{
+    int n = points.size();
+    Vector2 start = *std::min_element(points.begin(), points.end(), &compareVector2);
+
+    // the groups of a guess are runs of whole groups of the previous guess, so the points are copied only once
+    work = points;
+    groupHulls.resize(n);
+    chainScratch.resize(n);
+    for (int t = 1;; t++)
+    {
+        // the guess is squared every time, 2^(2^t), until all the points are in one group
+        groupSize = t >= 5 ? n : std::min<long long>(n, 1LL << (1 << t));
+        computeMiniHulls(groupSize);
+        hull.assign(1, start);
+
+        if constexpr (Recording::enabled)
+        {
+            ChanGuess guess;
+            guess.groupSize = groupSize;
+            guess.hullSize = hullSizes;
+            for (int group = 0; group < static_cast<int>(hullSizes.size()); group++)
+            {
+                guess.hullBegin.push_back(guess.groupHulls.size());
+                guess.groupHulls.insert(guess.groupHulls.end(), groupHulls.begin() + group * groupSize,
+                                        groupHulls.begin() + group * groupSize + hullSizes[group]);
+            }
+            guess.wrap = hull;
+            guesses.push_back(std::move(guess));
+            steps.push_back({GROUP_HULLS, static_cast<int>(guesses.size()) - 1, -1, 1, start, start, start});
+        }
+
+        if (wrap(groupSize))
+            break;
+
+        if constexpr (Recording::enabled)
+        {
+            steps.push_back({GUESS_FAILED, static_cast<int>(guesses.size()) - 1, -1, static_cast<int>(hull.size()),
+                             hull.back(), hull.back(), hull.back()});
+        }
+    }
+
+    if constexpr (Recording::enabled)
+    {
+        steps.push_back({FINISH, static_cast<int>(guesses.size()) - 1, -1, static_cast<int>(hull.size()), start, start,
+                         start});
+    }
+}
+
+template class ChanEngine<Record>;
+template class ChanEngine<NoRecord>;
\ No newline at end of file
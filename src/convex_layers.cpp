@@ -0,0 +1,223 @@
+/**
+ * @file convex_layers.cpp
+ * @brief Contains the implementation of the ConvexLayers class.
+ *
+ */
+#include "convex_layers.h"
+#include "raygui.h"
+
+const Color ConvexLayers::LAYER_COLORS[4] = {GREEN, ORANGE, PURPLE, SKYBLUE};
+
+ConvexLayers::ConvexLayers(std::vector<Vector2> p) : ConvexLayersEngine<Record>(std::move(p))
+{
+}
+
+ConvexLayers::~ConvexLayers()
+{
+}
+
+void ConvexLayers::drawLayer(int layer, Color lineColor, float lineThickness)
+{
+    int begin = layerOffsets[layer], size = layerOffsets[layer + 1] - begin;
+    for (int i = 0; i < size; i++)
+    {
+        if (size > 1)
+            DrawLineEx(layerPoints[begin + i], layerPoints[begin + (i + 1) % size], lineThickness, lineColor);
+        DrawCircleV(layerPoints[begin + i], 5, BLUE);
+    }
+}
+
+void ConvexLayers::draw()
+{
+    const ConvexLayersStep &step = steps[currentStep];
+    if (step.type == SORT)
+        return;
+
+    int lastLayer = step.type == FINISH ? getLayerCount() - 1 : step.layer;
+    for (int layer = 0; layer <= lastLayer; layer++)
+    {
+        if (step.type == LAYER && layer == step.layer)
+            drawLayer(layer, RED, 3);
+        else
+            drawLayer(layer, LAYER_COLORS[layer % 4], 2);
+    }
+    GuiLabel({10, 60, 400, 30}, TextFormat("Layer %d of %d", lastLayer + 1, getLayerCount()));
+}
+
+void ConvexLayers::next()
+{
+    if (currentStep < static_cast<int>(steps.size()) - 1)
+        currentStep++;
+}
+
+void ConvexLayers::previous()
+{
+    if (currentStep > 0)
+        currentStep--;
+}
+
+bool ConvexLayers::isFinished()
+{
+    return currentStep >= static_cast<int>(steps.size()) - 1;
+}
+
+int ConvexLayers::getNumberOfSteps()
+{
+    return steps.size();
+}
+
+int ConvexLayers::getCurrentStep()
+{
+    return currentStep;
+}
+
+void ConvexLayers::setCurrentStep(int step)
+{
+    currentStep = step;
+}
+
+std::vector<Vector2> ConvexLayers::exportHull()
+{
+    if (getLayerCount() == 0)
+        return {};
+    return getLayer(0);
+}
+
+void ConvexLayers::showLegend(bool *showLegend, Vector2 *windowPosition, Vector2 *windowSize,
+                              Vector2 *maxWindowSize, Vector2 *contentSize, Vector2 *scroll, bool *moving,
+                              bool *resizing, bool *minimized, float toolbarHeight, float bottomBarHeight,
+                              const char *title)
+{
+    float statusBarHeight = 24.0f, closeButtonSize = 18.0f;
+    if (*showLegend)
+    {
+        int closeTitleSizeDeltaHalf = (statusBarHeight - closeButtonSize) / 2;
+
+        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && !(*moving) && !(*resizing))
+        {
+            Vector2 mousePosition = GetMousePosition();
+
+            Rectangle titleCollisionRect = {(*windowPosition).x, (*windowPosition).y,
+                                            (*windowSize).x - (closeButtonSize + closeTitleSizeDeltaHalf),
+                                            statusBarHeight};
+            Rectangle resizeCollisionRect = {(*windowPosition).x + (*windowSize).x - 20.0f,
+                                             (*windowPosition).y + (*windowSize).y - 20.0f, 20.0f, 20.0f};
+
+            if (CheckCollisionPointRec(mousePosition, titleCollisionRect))
+            {
+                (*moving) = true;
+            }
+            else if (!(*minimized) && CheckCollisionPointRec(mousePosition, resizeCollisionRect))
+            {
+                (*resizing) = true;
+            }
+        }
+
+        if ((*moving))
+        {
+            Vector2 mouseDelta = GetMouseDelta();
+            (*windowPosition).x += mouseDelta.x;
+            (*windowPosition).y += mouseDelta.y;
+
+            if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
+            {
+                (*moving) = false;
+
+                if ((*windowPosition).x < 0.0f)
+                    (*windowPosition).x = 10.0f;
+                else if ((*windowPosition).x > GetScreenWidth() - (*windowSize).x)
+                    (*windowPosition).x = GetScreenWidth() - (*windowSize).x - 10.0f;
+                if ((*windowPosition).y < toolbarHeight)
+                    (*windowPosition).y = toolbarHeight + 10;
+                else if ((*windowPosition).y > GetScreenHeight() - toolbarHeight - bottomBarHeight)
+                    (*windowPosition).y = GetScreenHeight() - bottomBarHeight - statusBarHeight - 10.0f;
+            }
+        }
+        else if ((*resizing))
+        {
+            Vector2 mouseDelta = GetMouseDelta();
+            (*windowSize).x += mouseDelta.x;
+            (*windowSize).y += mouseDelta.y;
+
+            if ((*windowSize).x < 100.0f)
+                (*windowSize).x = 100.0f;
+            else if ((*windowSize).x > GetScreenWidth() - 10.0f)
+                (*windowSize).x = GetScreenWidth() - 10.0f;
+            if ((*windowSize).y < 100.0f)
+                (*windowSize).y = 100.0f;
+            else if ((*windowSize).y > GetScreenHeight() - toolbarHeight - bottomBarHeight - 10.0f)
+                (*windowSize).y = GetScreenHeight() - toolbarHeight - bottomBarHeight - 10.0f;
+
+            if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
+            {
+                (*resizing) = false;
+            }
+        }
+
+        if ((*minimized))
+        {
+            GuiStatusBar((Rectangle){(*windowPosition).x, (*windowPosition).y, (*windowSize).x, statusBarHeight},
+                         title);
+
+            if (GuiButton((Rectangle){(*windowPosition).x + (*windowSize).x - closeButtonSize - closeTitleSizeDeltaHalf,
+                                      (*windowPosition).y + closeTitleSizeDeltaHalf, closeButtonSize, closeButtonSize},
+                          "#120#"))
+            {
+                (*minimized) = false;
+                (*windowSize) = (*maxWindowSize);
+            }
+        }
+        else
+        {
+            (*minimized) = GuiWindowBox(
+                (Rectangle){(*windowPosition).x, (*windowPosition).y, (*windowSize).x, (*windowSize).y}, title);
+            if ((*minimized))
+            {
+                (*windowSize) = {(*maxWindowSize).x, statusBarHeight};
+            }
+
+            Rectangle scissor = {0};
+            GuiScrollPanel((Rectangle){(*windowPosition).x, (*windowPosition).y + statusBarHeight, (*windowSize).x,
+                                       (*windowSize).y - statusBarHeight},
+                           NULL, (Rectangle){(*windowPosition).x, (*windowSize).y, (*contentSize).x, (*contentSize).y},
+                           scroll, &scissor);
+
+            bool requireScissor = (*windowSize).x < (*contentSize).x || (*windowSize).y < (*contentSize).y;
+
+            if (requireScissor)
+            {
+                BeginScissorMode(scissor.x, scissor.y, scissor.width, scissor.height);
+            }
+
+            DrawCircleV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 50.0f + (*scroll).y}, 5,
+                        BLUE);
+            GuiLabel(
+                {(*windowPosition).x + 30.0f + (*scroll).x, (*windowPosition).y + 35.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Point on a Layer");
+
+            DrawLineV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 75.0f + (*scroll).y},
+                      {(*windowPosition).x + 80.0f + (*scroll).x, (*windowPosition).y + 75.0f + (*scroll).y}, RED);
+            GuiLabel(
+                {(*windowPosition).x + 90.0f + (*scroll).x, (*windowPosition).y + 60.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Layer Just Peeled");
+
+            for (int i = 0; i < 4; i++)
+            {
+                float left = (*windowPosition).x + 20.0f + i * 15.0f + (*scroll).x;
+                DrawLineV({left, (*windowPosition).y + 100.0f + (*scroll).y},
+                          {left + 15.0f, (*windowPosition).y + 100.0f + (*scroll).y}, LAYER_COLORS[i]);
+            }
+            GuiLabel(
+                {(*windowPosition).x + 90.0f + (*scroll).x, (*windowPosition).y + 85.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Layers Peeled Before, Outermost First");
+
+            if (requireScissor)
+            {
+                EndScissorMode();
+            }
+
+            GuiDrawIcon(71, (*windowPosition).x + (*windowSize).x - 20, (*windowPosition).y + (*windowSize).y - 20, 1,
+                        WHITE);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,293 @@
+/**
+ * @file convex_layers_engine.cpp
+ * @brief Contains the implementation of the ConvexLayersEngine class template.
+ *
+ */
+#include "convex_layers_engine.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+template <typename Recording>
+ConvexLayersEngine<Recording>::ConvexLayersEngine(std::vector<Vector2> p, int grainSize)
+    : grainSize(std::max(2, grainSize))
+{
+    points = std::move(p);
+
+    layerOffsets.push_back(0);
+    if (points.size() != 0)
+        computeConvexLayers();
+}
+
+template <typename Recording> int ConvexLayersEngine<Recording>::getLayerCount() const
+{
+    return layerOffsets.size() - 1;
+}
+
+template <typename Recording> std::vector<Vector2> ConvexLayersEngine<Recording>::getLayer(int layer) const
+{
+    return std::vector<Vector2>(layerPoints.begin() + layerOffsets[layer],
+                                layerPoints.begin() + layerOffsets[layer + 1]);
+}
+
+template <typename Recording> const std::vector<int> &ConvexLayersEngine<Recording>::getDepths() const
+{
+    return depths;
+}
+
+template <typename Recording> bool ConvexLayersEngine<Recording>::compareVector2(Vector2 a, Vector2 b)
+{
+    if (a.x == b.x)
+        return a.y < b.y;
+    return a.x < b.x;
+}
+
+template <typename Recording> float ConvexLayersEngine<Recording>::cross(Vector2 o, Vector2 a, Vector2 b)
+{
+    return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+}
+
+template <typename Recording>
+template <bool Upper>
+int ConvexLayersEngine<Recording>::buildChain(int *chain) const
+{
+    // only the points that make the chain turn the wrong way are popped, so the points on its edges stay, and only the
+    // first copy of a point is pushed
+    int size = 0;
+    for (int i = 0; i < static_cast<int>(active.size()); i++)
+    {
+        Vector2 p = active[i];
+        if (i > 0 && p.x == active[i - 1].x && p.y == active[i - 1].y)
+            continue;
+        while (size >= 2)
+        {
+            float turn = cross(active[chain[size - 2]], active[chain[size - 1]], p);
+            if (Upper ? turn <= 0 : turn >= 0)
+                break;
+            size--;
+        }
+        chain[size++] = i;
+    }
+    return size;
+}
+
+template <typename Recording> bool ConvexLayersEngine<Recording>::isLeftOf(Vector2 a, Vector2 b, Vector2 p)
+{
+    // the same test as HullPrefilter, so that the points on an edge of the polygon are always active
+    double x = (static_cast<double>(b.x) - a.x) * (static_cast<double>(p.y) - a.y);
+    double y = (static_cast<double>(b.y) - a.y) * (static_cast<double>(p.x) - a.x);
+    return x - y > 1e-9 * (std::abs(x) + std::abs(y));
+}
+
+template <typename Recording> void ConvexLayersEngine<Recording>::chooseAnchors(int aim)
+{
+    int m = sorted.size();
+    anchorLower.clear();
+    anchorUpper.clear();
+    anchorIndices.clear();
+    if (m <= 2 * aim)
+        return;
+
+    // the sample is small enough for all its points to be active, so peeling it chooses no polygon of its own
+    int stride = std::max(1, m / SAMPLE_SIZE);
+    std::vector<int> sample;
+    std::vector<Vector2> samplePoints;
+    for (int i = 0; i < m; i += stride)
+    {
+        sample.push_back(i);
+        samplePoints.push_back(sorted[i]);
+    }
+    ConvexLayersEngine<NoRecord> sampleLayers(samplePoints, grainSize);
+    const std::vector<int> &sampleDepths = sampleLayers.getDepths();
+
+    // the polygon is the first layer of the sample with the chosen part of the sample outside it
+    int size = sample.size();
+    std::vector<int> layerSizes(sampleLayers.getLayerCount());
+    for (int depth : sampleDepths)
+        layerSizes[depth]++;
+    int outside = std::clamp<int>(anchorScale * aim / m * size, 1, size / 2);
+    int layer = 0;
+    for (int count = 0; layer < static_cast<int>(layerSizes.size()) - 1 && count < outside; layer++)
+        count += layerSizes[layer];
+
+    // the chains of the polygon leave out the points on its edges, the corners being in sorted order already
+    std::vector<int> corners;
+    for (int i = 0; i < size; i++)
+    {
+        if (sampleDepths[i] == layer)
+            corners.push_back(sample[i]);
+    }
+    std::vector<int> lowerCorners, upperCorners;
+    for (int position : corners)
+    {
+        while (lowerCorners.size() >= 2 &&
+               cross(sorted[lowerCorners[lowerCorners.size() - 2]], sorted[lowerCorners.back()], sorted[position]) <= 0)
+            lowerCorners.pop_back();
+        lowerCorners.push_back(position);
+        while (upperCorners.size() >= 2 &&
+               cross(sorted[upperCorners[upperCorners.size() - 2]], sorted[upperCorners.back()], sorted[position]) >= 0)
+            upperCorners.pop_back();
+        upperCorners.push_back(position);
+    }
+    if (lowerCorners.size() + upperCorners.size() < 5)
+        return;
+
+    for (int position : lowerCorners)
+    {
+        anchorLower.push_back(sorted[position]);
+        anchorIndices.push_back(sortedIndices[position]);
+    }
+    for (int position : upperCorners)
+    {
+        anchorUpper.push_back(sorted[position]);
+        anchorIndices.push_back(sortedIndices[position]);
+    }
+}
+
+template <typename Recording> void ConvexLayersEngine<Recording>::selectActive()
+{
+    int m = 0;
+    for (int i = 0; i < static_cast<int>(sorted.size()); i++)
+    {
+        if (depths[sortedIndices[i]] != -1)
+            continue;
+        sorted[m] = sorted[i];
+        sortedIndices[m] = sortedIndices[i];
+        m++;
+    }
+    sorted.resize(m);
+    sortedIndices.resize(m);
+
+    // the aim balances the passes over all the points left when choosing a polygon against the passes over the active
+    // points for every layer
+    int aim = 32 * std::sqrt(m);
+    if (aim < MIN_ACTIVE_COUNT)
+        aim = MIN_ACTIVE_COUNT;
+    chooseAnchors(aim);
+
+    // the points are in sorted order, so the edges of the polygon above and below a point are found by walking along
+    // its chains
+    active.clear();
+    activeIndices.clear();
+    int lowerEdge = 0, upperEdge = 0;
+    for (int i = 0; i < m; i++)
+    {
+        Vector2 p = sorted[i];
+        bool inside = !anchorLower.empty() && p.x > anchorLower.front().x && p.x < anchorLower.back().x;
+        if (inside)
+        {
+            while (anchorLower[lowerEdge + 1].x < p.x)
+                lowerEdge++;
+            while (anchorUpper[upperEdge + 1].x < p.x)
+                upperEdge++;
+            inside = isLeftOf(anchorLower[lowerEdge], anchorLower[lowerEdge + 1], p) &&
+                     isLeftOf(anchorUpper[upperEdge + 1], anchorUpper[upperEdge], p);
+        }
+        if (!inside)
+        {
+            active.push_back(p);
+            activeIndices.push_back(sortedIndices[i]);
+        }
+    }
+    if (!anchorLower.empty())
+        anchorScale = std::clamp(anchorScale * aim / active.size(), 1.0 / 64, 64.0);
+    upper.resize(active.size());
+    lower.resize(active.size());
+    onLayer.assign(active.size(), 0);
+}
+
+template <typename Recording> int ConvexLayersEngine<Recording>::peelLayer()
+{
+    int count = active.size();
+    int upperCount = 0, lowerCount = 0;
+    auto buildUpper = [&]() { upperCount = buildChain<true>(upper.data()); };
+    auto buildLower = [&]() { lowerCount = buildChain<false>(lower.data()); };
+    if (count >= grainSize)
+        scheduler->run([&]() { scheduler->invoke(buildUpper, buildLower); });
+    else
+    {
+        buildUpper();
+        buildLower();
+    }
+
+    // the layer is the upper chain followed by the lower chain in reverse, a point being taken once even when all the
+    // active points lie on a line and so on both chains, and every copy of a point is marked with it
+    int layer = layerOffsets.size() - 1;
+    int peeled = 0;
+    auto take = [&](int position) {
+        if (onLayer[position])
+            return;
+        Vector2 p = active[position];
+        layerPoints.push_back(p);
+        for (int i = position; i < count && active[i].x == p.x && active[i].y == p.y; i++)
+        {
+            onLayer[i] = 1;
+            depths[activeIndices[i]] = layer;
+            peeled++;
+        }
+    };
+    for (int i = 0; i < upperCount; i++)
+        take(upper[i]);
+    for (int i = lowerCount - 2; i > 0; i--)
+        take(lower[i]);
+    layerOffsets.push_back(layerPoints.size());
+
+    // the points of the layer are removed in place, the others keeping their sorted order
+    int left = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (onLayer[i])
+        {
+            onLayer[i] = 0;
+            continue;
+        }
+        active[left] = active[i];
+        activeIndices[left] = activeIndices[i];
+        left++;
+    }
+    active.resize(left);
+    activeIndices.resize(left);
+    return peeled;
+}
+
+template <typename Recording> void ConvexLayersEngine<Recording>::computeConvexLayers()
+{
+    int n = points.size();
+    sortedIndices.resize(n);
+    std::iota(sortedIndices.begin(), sortedIndices.end(), 0);
+    std::sort(sortedIndices.begin(), sortedIndices.end(), [this](int a, int b) {
+        if (compareVector2(points[a], points[b]))
+            return true;
+        return !compareVector2(points[b], points[a]) && a < b;
+    });
+    sorted.resize(n);
+    for (int i = 0; i < n; i++)
+        sorted[i] = points[sortedIndices[i]];
+    depths.assign(n, -1);
+    if constexpr (Recording::enabled)
+        steps.push_back({SORT, -1});
+
+    // the active points are gathered again once they run out, or once a layer took a corner of the anchor polygon
+    scheduler = &TaskScheduler::shared();
+    int left = n;
+    bool stale = true;
+    while (left > 0)
+    {
+        if (stale)
+            selectActive();
+        left -= peelLayer();
+        if constexpr (Recording::enabled)
+            steps.push_back({LAYER, static_cast<int>(layerOffsets.size()) - 2});
+
+        stale = active.empty();
+        for (int index : anchorIndices)
+            stale |= depths[index] != -1;
+    }
+
+    if constexpr (Recording::enabled)
+        steps.push_back({FINISH, -1});
+}
+
+template class ConvexLayersEngine<Record>;
+template class ConvexLayersEngine<NoRecord>;
\ No newline at end of file
@@ -0,0 +1,293 @@
+/**
+ * @file dynamic_hull.cpp
+ * @brief Contains the implementation of the DynamicHull class.
+ *
+ */
+#include "dynamic_hull.h"
+#include <algorithm>
+#include <cmath>
+
+DynamicHull::DynamicHull()
+{
+}
+
+DynamicHull::DynamicHull(std::vector<Vector2> points)
+{
+    // the points are sorted and counted, so the tree is built bottom up with every bridge computed once
+    std::sort(points.begin(), points.end(), &compareVector2);
+    std::vector<Vector2> unique;
+    std::vector<int> counts;
+    for (Vector2 p : points)
+    {
+        if (!unique.empty() && unique.back().x == p.x && unique.back().y == p.y)
+            counts.back()++;
+        else
+        {
+            unique.push_back(p);
+            counts.push_back(1);
+        }
+    }
+    pointCount = points.size();
+    if (!unique.empty())
+        root = build(unique, counts, 0, unique.size());
+}
+
+void DynamicHull::insert(Vector2 p)
+{
+    root = insert(root, p);
+    pointCount++;
+}
+
+bool DynamicHull::erase(Vector2 p)
+{
+    bool found = false;
+    if (root != -1)
+        root = erase(root, p, found);
+    if (found)
+        pointCount--;
+    return found;
+}
+
+void DynamicHull::clear()
+{
+    nodes.clear();
+    freeNodes.clear();
+    root = -1;
+    pointCount = 0;
+}
+
+int DynamicHull::size() const
+{
+    return pointCount;
+}
+
+std::vector<Vector2> DynamicHull::getConvexHull() const
+{
+    std::vector<Vector2> hull, lowerHull;
+    if (root == -1)
+        return hull;
+
+    // both halves run from the smallest point to the largest one, which they share, so the hull is the upper half
+    // followed by the inner points of the lower half in reverse
+    Vector2 lo = {-INFINITY, -INFINITY}, hi = {INFINITY, INFINITY};
+    report<UPPER>(root, lo, hi, hull);
+    report<LOWER>(root, lo, hi, lowerHull);
+    for (int i = static_cast<int>(lowerHull.size()) - 2; i > 0; i--)
+        hull.push_back(lowerHull[i]);
+    return hull;
+}
+
+bool DynamicHull::compareVector2(Vector2 a, Vector2 b)
+{
+    if (a.x == b.x)
+        return a.y < b.y;
+    return a.x < b.x;
+}
+
+float DynamicHull::cross(Vector2 o, Vector2 a, Vector2 b)
+{
+    return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+}
+
+template <DynamicHull::Side S> Vector2 DynamicHull::orient(Vector2 v)
+{
+    if constexpr (S == LOWER)
+        v.y = -v.y;
+    return v;
+}
+
+template <DynamicHull::Side S> std::pair<Vector2, Vector2> DynamicHull::edge(int v) const
+{
+    const Node &node = nodes[v];
+    if (node.left == -1)
+        return {orient<S>(node.point), orient<S>(node.point)};
+    return {orient<S>(node.bridges[S].first), orient<S>(node.bridges[S].second)};
+}
+
+template <DynamicHull::Side S> Vector2 DynamicHull::tangent(int v, Vector2 q) const
+{
+    // the tangent point is past the edge of a node exactly when q is below the line through the edge, and the part of
+    // the hull of the subtree on either side of the edge is the hull of that child up to or from the edge
+    while (nodes[v].left != -1)
+    {
+        auto [a, b] = edge<S>(v);
+        v = cross(a, b, q) < 0 ? nodes[v].right : nodes[v].left;
+    }
+    return orient<S>(nodes[v].point);
+}
+
+template <DynamicHull::Side S> std::pair<Vector2, Vector2> DynamicHull::bridge(int v) const
+{
+    // the bridge is past the edge (c, d) of the right hull exactly when c is below or on the line from the tangent
+    // point of d on the left hull to d
+    int left = nodes[v].left, w = nodes[v].right;
+    while (nodes[w].left != -1)
+    {
+        auto [c, d] = edge<S>(w);
+        w = cross(tangent<S>(left, d), d, c) <= 0 ? nodes[w].right : nodes[w].left;
+    }
+    Vector2 r = orient<S>(nodes[w].point);
+    return {orient<S>(tangent<S>(left, r)), orient<S>(r)};
+}
+
+template <DynamicHull::Side S> void DynamicHull::report(int v, Vector2 lo, Vector2 hi, std::vector<Vector2> &out) const
+{
+    const Node &node = nodes[v];
+    if (node.left == -1)
+    {
+        if (!compareVector2(node.point, lo) && !compareVector2(hi, node.point))
+            out.push_back(node.point);
+        return;
+    }
+
+    // the hull of the subtree is the hull of the left child up to the bridge and the hull of the right child from it
+    auto [a, b] = node.bridges[S];
+    if (!compareVector2(a, lo))
+        report<S>(node.left, lo, compareVector2(hi, a) ? hi : a, out);
+    if (!compareVector2(hi, b))
+        report<S>(node.right, compareVector2(lo, b) ? b : lo, hi, out);
+}
+
+int DynamicHull::makeLeaf(Vector2 p, int count)
+{
+    Node node = {p, count, -1, -1, 0, {{p, p}, {p, p}}};
+    if (freeNodes.empty())
+    {
+        nodes.push_back(node);
+        return nodes.size() - 1;
+    }
+    int v = freeNodes.back();
+    freeNodes.pop_back();
+    nodes[v] = node;
+    return v;
+}
+
+int DynamicHull::makeInner(int left, int right)
+{
+    int v = makeLeaf(nodes[right].point, 0);
+    nodes[v].left = left;
+    nodes[v].right = right;
+    pull(v);
+    return v;
+}
+
+void DynamicHull::freeNode(int v)
+{
+    freeNodes.push_back(v);
+}
+
+void DynamicHull::pull(int v)
+{
+    Node &node = nodes[v];
+    node.height = std::max(nodes[node.left].height, nodes[node.right].height) + 1;
+    node.point = nodes[node.right].point;
+    node.bridges[UPPER] = bridge<UPPER>(v);
+    node.bridges[LOWER] = bridge<LOWER>(v);
+}
+
+int DynamicHull::rotateLeft(int v)
+{
+    int u = nodes[v].right;
+    nodes[v].right = nodes[u].left;
+    pull(v);
+    nodes[u].left = v;
+    pull(u);
+    return u;
+}
+
+int DynamicHull::rotateRight(int v)
+{
+    int u = nodes[v].left;
+    nodes[v].left = nodes[u].right;
+    pull(v);
+    nodes[u].right = v;
+    pull(u);
+    return u;
+}
+
+int DynamicHull::rebalance(int v)
+{
+    int left = nodes[v].left, right = nodes[v].right;
+    int balance = nodes[left].height - nodes[right].height;
+    if (balance > 1)
+    {
+        if (nodes[nodes[left].left].height < nodes[nodes[left].right].height)
+            nodes[v].left = rotateLeft(left);
+        return rotateRight(v);
+    }
+    if (balance < -1)
+    {
+        if (nodes[nodes[right].right].height < nodes[nodes[right].left].height)
+            nodes[v].right = rotateRight(right);
+        return rotateLeft(v);
+    }
+    pull(v);
+    return v;
+}
+
+int DynamicHull::build(const std::vector<Vector2> &points, const std::vector<int> &counts, int begin, int end)
+{
+    if (end - begin == 1)
+        return makeLeaf(points[begin], counts[begin]);
+    int mid = begin + (end - begin) / 2;
+    int left = build(points, counts, begin, mid);
+    int right = build(points, counts, mid, end);
+    return makeInner(left, right);
+}
+
+int DynamicHull::insert(int v, Vector2 p)
+{
+    if (v == -1)
+        return makeLeaf(p, 1);
+
+    if (nodes[v].left == -1)
+    {
+        Vector2 q = nodes[v].point;
+        if (q.x == p.x && q.y == p.y)
+        {
+            nodes[v].count++;
+            return v;
+        }
+        int leaf = makeLeaf(p, 1);
+        return compareVector2(p, q) ? makeInner(leaf, v) : makeInner(v, leaf);
+    }
+
+    // the largest point of the left subtree splits the points between the children
+    if (compareVector2(nodes[nodes[v].left].point, p))
+        nodes[v].right = insert(nodes[v].right, p);
+    else
+        nodes[v].left = insert(nodes[v].left, p);
+    return rebalance(v);
+}
+
+int DynamicHull::erase(int v, Vector2 p, bool &found)
+{
+    if (nodes[v].left == -1)
+    {
+        Vector2 q = nodes[v].point;
+        if (q.x != p.x || q.y != p.y)
+            return v;
+        found = true;
+        if (--nodes[v].count > 0)
+            return v;
+        freeNode(v);
+        return -1;
+    }
+
+    // an inner node whose child is gone is replaced by its other child
+    int left = nodes[v].left, right = nodes[v].right;
+    if (compareVector2(nodes[left].point, p))
+        right = erase(right, p, found);
+    else
+        left = erase(left, p, found);
+    if (!found)
+        return v;
+    if (left == -1 || right == -1)
+    {
+        freeNode(v);
+        return left == -1 ? right : left;
+    }
+    nodes[v].left = left;
+    nodes[v].right = right;
+    return rebalance(v);
+}
\ No newline at end of file
@@ -0,0 +1,149 @@
+/**
+ * @file hull_prefilter.cpp
+ * @brief Contains the implementation of the HullPrefilter class.
+ *
+ */
+#include "hull_prefilter.h"
+#include "task_scheduler.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+HullPrefilter::HullPrefilter(int directionCount)
+{
+    directionCount = std::max(3, directionCount);
+    for (int i = 0; i < directionCount; i++)
+    {
+        // the directions go counter-clockwise, so the extreme points do too
+        double angle = 2 * M_PI * i / directionCount;
+        directions.push_back({static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle))});
+    }
+}
+
+std::vector<Vector2> HullPrefilter::filter(const std::vector<Vector2> &points)
+{
+    return filterPoints(points.size(), [&](int i) { return points[i]; });
+}
+
+std::vector<Vector2> HullPrefilter::filter(const float *xs, const float *ys, int count)
+{
+    return filterPoints(count, [&](int i) { return Vector2{xs[i], ys[i]}; });
+}
+
+template <typename Point> std::vector<Vector2> HullPrefilter::filterPoints(int count, Point point)
+{
+    polygon.clear();
+    discardedCount = 0;
+    auto allPoints = [&]() {
+        std::vector<Vector2> result(count);
+        for (int i = 0; i < count; i++)
+            result[i] = point(i);
+        return result;
+    };
+    if (count < 4)
+        return allPoints();
+
+    std::vector<int> extremes = findExtremes(count, point);
+    for (int index : extremes)
+    {
+        Vector2 v = point(index);
+        if (polygon.empty() || v.x != polygon.back().x || v.y != polygon.back().y)
+            polygon.push_back(v);
+    }
+    if (polygon.size() > 1 && polygon.front().x == polygon.back().x && polygon.front().y == polygon.back().y)
+        polygon.pop_back();
+    if (polygon.size() < 3)
+        return allPoints();
+
+    // every chunk keeps its points in a buffer of its own, and the buffers are joined in chunk order
+    int chunkCount = (count + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    std::vector<std::vector<Vector2>> kept(chunkCount);
+    TaskScheduler::shared().parallelFor(0, chunkCount, [&](int chunk) {
+        int begin = chunk * CHUNK_SIZE, end = std::min(count, begin + CHUNK_SIZE);
+        for (int i = begin; i < end; i++)
+        {
+            Vector2 p = point(i);
+            if (!isInside(p))
+                kept[chunk].push_back(p);
+        }
+    });
+
+    std::vector<Vector2> result;
+    for (auto &chunk : kept)
+        result.insert(result.end(), chunk.begin(), chunk.end());
+    discardedCount = count - result.size();
+    return result;
+}
+
+int HullPrefilter::getDiscardedCount() const
+{
+    return discardedCount;
+}
+
+int HullPrefilter::getDirectionCount() const
+{
+    return directions.size();
+}
+
+const std::vector<Vector2> &HullPrefilter::getPolygon() const
+{
+    return polygon;
+}
+
+template <typename Point> std::vector<int> HullPrefilter::findExtremes(int count, Point point) const
+{
+    int directionCount = directions.size();
+    int chunkCount = (count + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    std::vector<float> bestDistance(chunkCount * directionCount);
+    std::vector<int> bestIndex(chunkCount * directionCount);
+
+    TaskScheduler::shared().parallelFor(0, chunkCount, [&](int chunk) {
+        int begin = chunk * CHUNK_SIZE, end = std::min(count, begin + CHUNK_SIZE);
+        for (int d = 0; d < directionCount; d++)
+        {
+            Vector2 direction = directions[d];
+            float best = -std::numeric_limits<float>::infinity();
+            int index = begin;
+            for (int i = begin; i < end; i++)
+            {
+                Vector2 p = point(i);
+                float distance = direction.x * p.x + direction.y * p.y;
+                index = distance > best ? i : index;
+                best = std::max(best, distance);
+            }
+            bestDistance[chunk * directionCount + d] = best;
+            bestIndex[chunk * directionCount + d] = index;
+        }
+    });
+
+    // the chunks are merged in order with a strict comparison, so the first extreme point wins whatever the chunking
+    std::vector<int> extremes(directionCount);
+    for (int d = 0; d < directionCount; d++)
+    {
+        int best = d;
+        for (int chunk = 1; chunk < chunkCount; chunk++)
+        {
+            if (bestDistance[chunk * directionCount + d] > bestDistance[best])
+                best = chunk * directionCount + d;
+        }
+        extremes[d] = bestIndex[best];
+    }
+    return extremes;
+}
+
+bool HullPrefilter::isInside(Vector2 p) const
+{
+    // the cross products are taken in double, and a point counts as inside only when every one of them clears a
+    // margin far above their rounding error, so points on an edge of the polygon are always kept
+    bool inside = true;
+    int n = polygon.size();
+    for (int i = 0, j = n - 1; i < n; j = i++)
+    {
+        double edgeX = static_cast<double>(polygon[i].x) - polygon[j].x;
+        double edgeY = static_cast<double>(polygon[i].y) - polygon[j].y;
+        double a = edgeX * (static_cast<double>(p.y) - polygon[j].y);
+        double b = edgeY * (static_cast<double>(p.x) - polygon[j].x);
+        inside &= a - b > 1e-9 * (std::abs(a) + std::abs(b));
+    }
+    return inside;
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+/**
+ * @file incremental_hull.cpp
+ * @brief Contains the implementation of the IncrementalHull class.
+ *
+ */
+#include "incremental_hull.h"
+#include <iterator>
+
+IncrementalHull::IncrementalHull()
+{
+}
+
+IncrementalHull::IncrementalHull(const std::vector<Vector2> &points)
+{
+    for (Vector2 p : points)
+        insert(p);
+}
+
+bool IncrementalHull::insert(Vector2 p)
+{
+    bool upperChanged = insertUpper(upper, p);
+    bool lowerChanged = insertUpper(lower, {p.x, -p.y});
+    return upperChanged || lowerChanged;
+}
+
+bool IncrementalHull::contains(Vector2 p) const
+{
+    return isBelowUpper(upper, p) && isBelowUpper(lower, {p.x, -p.y});
+}
+
+void IncrementalHull::clear()
+{
+    upper.clear();
+    lower.clear();
+}
+
+std::vector<Vector2> IncrementalHull::getConvexHull() const
+{
+    std::vector<Vector2> hull;
+    if (upper.empty())
+        return hull;
+
+    // the chains share their end points unless the hull has a vertical edge there, in which case the lowest point of
+    // that edge is taken from the lower chain
+    std::vector<Vector2> lowerChain;
+    for (auto [x, y] : lower)
+        lowerChain.push_back({x, -y});
+    int k = lowerChain.size();
+
+    if (lowerChain[0].y != upper.begin()->second)
+        hull.push_back(lowerChain[0]);
+    for (auto [x, y] : upper)
+        hull.push_back({x, y});
+    if (k >= 2 && lowerChain[k - 1].y != upper.rbegin()->second)
+        hull.push_back(lowerChain[k - 1]);
+    for (int i = k - 2; i > 0; i--)
+        hull.push_back(lowerChain[i]);
+    return hull;
+}
+
+float IncrementalHull::cross(Vector2 o, Vector2 a, Vector2 b)
+{
+    return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+}
+
+bool IncrementalHull::insertUpper(Chain &chain, Vector2 p)
+{
+    auto point = [](Chain::const_iterator it) { return Vector2{it->first, it->second}; };
+
+    // a point with the x co-ordinate of a chain point replaces it when above it, and otherwise is kept when above the
+    // segment between its neighbours
+    auto next = chain.lower_bound(p.x);
+    if (next != chain.end() && next->first == p.x)
+    {
+        if (next->second >= p.y)
+            return false;
+        next = chain.erase(next);
+    }
+    else if (next != chain.end() && next != chain.begin() && cross(point(std::prev(next)), p, point(next)) >= 0)
+        return false;
+
+    // the neighbours that the point hides are removed on either side, as in the monotone chain
+    auto it = chain.emplace_hint(next, p.x, p.y);
+    while (std::next(it) != chain.end() && std::next(it, 2) != chain.end() &&
+           cross(p, point(std::next(it)), point(std::next(it, 2))) >= 0)
+        chain.erase(std::next(it));
+    while (it != chain.begin() && std::prev(it) != chain.begin() &&
+           cross(point(std::prev(it, 2)), point(std::prev(it)), p) >= 0)
+        chain.erase(std::prev(it));
+    return true;
+}
+
+bool IncrementalHull::isBelowUpper(const Chain &chain, Vector2 p)
+{
+    auto next = chain.lower_bound(p.x);
+    if (next == chain.end())
+        return false;
+    if (next->first == p.x)
+        return p.y <= next->second;
+    if (next == chain.begin())
+        return false;
+    auto previous = std::prev(next);
+    return cross({previous->first, previous->second}, p, {next->first, next->second}) >= 0;
+}
\ No newline at end of file
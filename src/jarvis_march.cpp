@@ -7,14 +7,10 @@
 #include "raygui.h"
 
 JarvisMarch::JarvisMarch(std::vector<Vector2> p)
+    : JarvisMarchEngine<Record>(std::move(p), true),
+      stepLog(getFirstStep(), [this](const JarvisMarchStep &from) { return generateSteps(from); })
 {
-    n = p.size();
-    points = p;
     currentStep = 0;
-    if (n != 0)
-    {
-        computeConvexHull();
-    }
 }
 
 JarvisMarch::~JarvisMarch()
@@ -23,53 +19,29 @@ JarvisMarch::~JarvisMarch()
 
 void JarvisMarch::drawConvexHull()
 {
-    for (auto &p : steps[currentStep].convexHull)
+    // the hull of the current step is a prefix of the final hull
+    int hullLength = stepLog.get(currentStep).hullLength;
+    for (int i = 0; i < hullLength; i++)
     {
-        DrawCircle(p.x, p.y, 5, BLUE);
+        DrawCircle(convexHull[i].x, convexHull[i].y, 5, BLUE);
     }
-    for (int i = 0; i < steps[currentStep].convexHull.size() - 1; i++)
+    for (int i = 0; i < hullLength - 1; i++)
     {
-        DrawLineEx(steps[currentStep].convexHull[i], steps[currentStep].convexHull[i + 1], 2, GREEN);
+        DrawLineEx(convexHull[i], convexHull[i + 1], 2, GREEN);
     }
 }
 
-int JarvisMarch::getLeftMostPointIndex()
-{
-    int left = 0;
-    for (int i = 0; i < n; i++)
-    {
-        if (points[i].x < points[left].x)
-        {
-            left = i;
-        }
-        else if (points[i].x == points[left].x && points[i].y < points[left].y)
-        {
-            left = i;
-        }
-    }
-    return left;
-}
-
-JarvisMarch::Orientation JarvisMarch::orientation(Vector2 p, Vector2 q, Vector2 r)
-{
-    float val = (q.y - p.y) * (r.x - q.x) - (q.x - p.x) * (r.y - q.y);
-    if (val == 0)
-    {
-        return Orientation::COLLINEAR;
-    }
-    return (val > 0) ? Orientation::CLOCKWISE : Orientation::COUNTER_CLOCKWISE;
-}
-
 void JarvisMarch::draw()
 {
 
     // BeginDrawing();
     if (!isFinished())
     {
-        DrawCircleV(points[steps[currentStep].nextPointIndex], 5, ORANGE);
-        DrawCircleV(points[steps[currentStep].candidatePointIndex], 5, PURPLE);
-        DrawLineV(points[steps[currentStep].currentPointIndex], points[steps[currentStep].nextPointIndex], BLACK);
-        DrawLineV(points[steps[currentStep].currentPointIndex], points[steps[currentStep].candidatePointIndex], RED);
+        const JarvisMarchStep &step = stepLog.get(currentStep);
+        DrawCircleV(points[step.nextPointIndex], 5, ORANGE);
+        DrawCircleV(points[step.candidatePointIndex], 5, PURPLE);
+        DrawLineV(points[step.currentPointIndex], points[step.nextPointIndex], BLACK);
+        DrawLineV(points[step.currentPointIndex], points[step.candidatePointIndex], RED);
     }
     drawConvexHull();
     // EndDrawing();
@@ -77,7 +49,7 @@ void JarvisMarch::draw()
 
 void JarvisMarch::next()
 {
-    if (currentStep < steps.size() - 1)
+    if (!isFinished())
     {
         currentStep++;
     }
@@ -91,8 +63,9 @@ void JarvisMarch::previous()
 
 int JarvisMarch::getNumberOfSteps()
 {
-
-    return steps.size();
+    // generating the step after the current one tells whether there is one
+    stepLog.get(currentStep + 1);
+    return stepLog.getKnownCount();
 }
 
 int JarvisMarch::getCurrentStep()
@@ -102,41 +75,7 @@ int JarvisMarch::getCurrentStep()
 
 bool JarvisMarch::isFinished()
 {
-    return currentStep >= steps.size() - 1;
-}
-
-void JarvisMarch::computeConvexHull()
-{
-    if (n < 3)
-    {
-        convexHull = points;
-        steps.push_back((struct JarvisMarchStep){0, 0, 0, convexHull});
-        return;
-    }
-
-    int left = getLeftMostPointIndex();
-    int current = left, next;
-
-    do
-    {
-        convexHull.push_back(points[current]);
-        next = (current + 1) % n;
-
-        for (int i = 0; i < n; i++)
-        {
-            steps.push_back((struct JarvisMarchStep){current, next, i, convexHull});
-            if (orientation(points[current], points[i], points[next]) == Orientation::COUNTER_CLOCKWISE)
-            {
-                next = i;
-            }
-        }
-
-        current = next;
-    } while (current != left);
-    ;
-
-    convexHull.push_back(convexHull[0]);
-    steps.push_back((struct JarvisMarchStep){current, next, 0, convexHull});
+    return currentStep >= getNumberOfSteps() - 1;
 }
 
 void JarvisMarch::setCurrentStep(int step)
@@ -146,6 +85,9 @@ void JarvisMarch::setCurrentStep(int step)
 
 std::vector<Vector2> JarvisMarch::exportHull()
 {
+    // the hull is only complete once the last step has been generated, otherwise it is computed on its own
+    if (!stepLog.isComplete())
+        return JarvisMarchEngine<NoRecord>(points).getConvexHull();
     return convexHull;
 }
 
@@ -0,0 +1,164 @@
+/**
+ * @file jarvis_march_engine.cpp
+ * @brief Contains the implementation of the JarvisMarchEngine class template.
+ *
+ */
+#include "jarvis_march_engine.h"
+
+template <typename Recording> JarvisMarchEngine<Recording>::JarvisMarchEngine(std::vector<Vector2> p, bool lazy)
+{
+    n = p.size();
+    points = std::move(p);
+    if (n != 0)
+    {
+        leftMostPointIndex = getLeftMostPointIndex();
+        if (!lazy)
+            computeConvexHull();
+    }
+}
+
+template <typename Recording> const std::vector<Vector2> &JarvisMarchEngine<Recording>::getConvexHull() const
+{
+    return convexHull;
+}
+
+template <typename Recording> int JarvisMarchEngine<Recording>::getLeftMostPointIndex()
+{
+    int left = 0;
+    for (int i = 0; i < n; i++)
+    {
+        if (points[i].x < points[left].x)
+        {
+            left = i;
+        }
+        else if (points[i].x == points[left].x && points[i].y < points[left].y)
+        {
+            left = i;
+        }
+    }
+    return left;
+}
+
+template <typename Recording>
+typename JarvisMarchEngine<Recording>::Orientation JarvisMarchEngine<Recording>::orientation(Vector2 p, Vector2 q,
+                                                                                             Vector2 r)
+{
+    float val = (q.y - p.y) * (r.x - q.x) - (q.x - p.x) * (r.y - q.y);
+    if (val == 0)
+    {
+        return Orientation::COLLINEAR;
+    }
+    return (val > 0) ? Orientation::CLOCKWISE : Orientation::COUNTER_CLOCKWISE;
+}
+
+template <typename Recording>
+bool JarvisMarchEngine<Recording>::replacesNext(Vector2 current, Vector2 candidate, Vector2 next)
+{
+    Orientation turn = orientation(current, candidate, next);
+    if (turn != Orientation::COLLINEAR)
+        return turn == Orientation::COUNTER_CLOCKWISE;
+    float candidateX = candidate.x - current.x, candidateY = candidate.y - current.y;
+    float nextX = next.x - current.x, nextY = next.y - current.y;
+    return candidateX * candidateX + candidateY * candidateY > nextX * nextX + nextY * nextY;
+}
+
+template <typename Recording> bool JarvisMarchEngine<Recording>::isLeftMostPoint(int index) const
+{
+    return points[index].x == points[leftMostPointIndex].x && points[index].y == points[leftMostPointIndex].y;
+}
+
+template <typename Recording> void JarvisMarchEngine<Recording>::computeConvexHull()
+{
+    // the recorded steps are the ones generateSteps() yields, so the eager and lazy visualizations match
+    if constexpr (Recording::enabled)
+    {
+        StepGenerator<JarvisMarchStep> generator = generateSteps(getFirstStep());
+        while (generator.next())
+            steps.push_back(generator.current());
+        return;
+    }
+
+    if (n < 3)
+    {
+        convexHull = points;
+        return;
+    }
+
+    int current = leftMostPointIndex, next;
+
+    do
+    {
+        convexHull.push_back(points[current]);
+        next = (current + 1) % n;
+
+        for (int i = 0; i < n; i++)
+        {
+            if (replacesNext(points[current], points[i], points[next]))
+            {
+                next = i;
+            }
+        }
+
+        current = next;
+    } while (!isLeftMostPoint(current));
+
+    convexHull.push_back(convexHull[0]);
+}
+
+template <typename Recording>
+typename JarvisMarchEngine<Recording>::JarvisMarchStep JarvisMarchEngine<Recording>::getFirstStep() const
+{
+    if (n < 3)
+        return {0, 0, 0, n};
+    return {leftMostPointIndex, (leftMostPointIndex + 1) % n, 0, 1};
+}
+
+template <typename Recording>
+StepGenerator<typename JarvisMarchEngine<Recording>::JarvisMarchStep> JarvisMarchEngine<Recording>::generateSteps(
+    JarvisMarchStep from)
+{
+    if (n < 3)
+    {
+        convexHull = points;
+        co_yield {0, 0, 0, n};
+        co_return;
+    }
+
+    // only the last step has the next point equal to the current one, as the march is back at the left most point
+    int current = from.currentPointIndex, next = from.nextPointIndex, i = from.candidatePointIndex;
+    int hullLength = from.hullLength;
+    if (current != next)
+    {
+        if (static_cast<int>(convexHull.size()) < hullLength)
+            convexHull.push_back(points[current]);
+
+        while (true)
+        {
+            for (; i < n; i++)
+            {
+                co_yield {current, next, i, hullLength};
+                if (replacesNext(points[current], points[i], points[next]))
+                {
+                    next = i;
+                }
+            }
+
+            current = next;
+            if (isLeftMostPoint(current))
+                break;
+            hullLength++;
+            if (static_cast<int>(convexHull.size()) < hullLength)
+                convexHull.push_back(points[current]);
+            next = (current + 1) % n;
+            i = 0;
+        }
+
+        hullLength++;
+        if (static_cast<int>(convexHull.size()) < hullLength)
+            convexHull.push_back(convexHull[0]);
+    }
+    co_yield {current, next, 0, hullLength};
+}
+
+template class JarvisMarchEngine<Record>;
+template class JarvisMarchEngine<NoRecord>;
\ No newline at end of file
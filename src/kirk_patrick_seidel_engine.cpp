@@ -0,0 +1,585 @@
+/**
+ * @file kirk_patrick_seidel_engine.cpp
+ * @brief Contains the implementation of the KirkpatrickSeidelEngine class template.
+ *
+ */
+#include "kirk_patrick_seidel_engine.h"
+#include "selection.h"
+#include "simd_kernels.h"
+
+template <typename Recording>
+KirkpatrickSeidelEngine<Recording>::KirkpatrickSeidelEngine(std::vector<Vector2> p, int grainSize,
+                                                            const std::atomic<bool> *cancelled)
+    : grainSize(std::max(3, grainSize)), cancelled(cancelled)
+{
+    points = std::move(p);
+
+    if (points.size() != 0)
+        hull = convexHull(points);
+}
+
+template <typename Recording> const std::vector<Vector2> &KirkpatrickSeidelEngine<Recording>::getConvexHull() const
+{
+    return hull;
+}
+
+template <typename Recording> bool KirkpatrickSeidelEngine<Recording>::isCancelled() const
+{
+    return cancelled != nullptr && *cancelled;
+}
+
+template <typename Recording> bool KirkpatrickSeidelEngine<Recording>::compareVector2(Vector2 a, Vector2 b)
+{
+    if (a.x == b.x)
+        return a.y < b.y;
+    return a.x < b.x;
+}
+
+template <typename Recording>
+template <typename KirkpatrickSeidelEngine<Recording>::State Side>
+Vector2 KirkpatrickSeidelEngine<Recording>::orient(Vector2 v)
+{
+    if constexpr (Side == LOWER_HULL)
+        v.y = -v.y;
+    return v;
+}
+
+template <typename Recording>
+template <typename KirkpatrickSeidelEngine<Recording>::State Side>
+bool KirkpatrickSeidelEngine<Recording>::compareOriented(Vector2 a, Vector2 b)
+{
+    return compareVector2(orient<Side>(a), orient<Side>(b));
+}
+
+template <typename Recording>
+template <typename KirkpatrickSeidelEngine<Recording>::State Side>
+std::pair<Vector2, Vector2> KirkpatrickSeidelEngine<Recording>::bridge(HullContext &context, Scratch &scratch,
+                                                                       int begin, int end, float L)
+{
+    // the slopes and intercepts are those of the oriented points, while the points recorded and returned are the
+    // original ones, so the lower bridge is found without mirroring the data
+    constexpr float ySign = Side == UPPER_HULL ? 1 : -1;
+
+    // the first round reads the points straight out of the working buffer, later rounds read the candidates left over
+    // by the previous round while writing the next ones into the other candidate buffer
+    const Vector2 *S = context.work.data() + begin;
+    int n = end - begin;
+    std::vector<Vector2> *candidates = &scratch.bridgeCandidates[0], *nextCandidates = &scratch.bridgeCandidates[1];
+
+    while (n > 2)
+    {
+        candidates->clear();
+
+        // make pairs, the i-th pair is made of S[i] and S[n - 1 - i] with the point having the smaller x first
+        int pairCount = n / 2;
+        auto pairAt = [S, n](int i) {
+            int p_i = i, p_j = n - 1 - i;
+            if (S[p_i].x > S[p_j].x)
+                std::swap(p_i, p_j);
+            return std::pair<int, int>(p_i, p_j);
+        };
+
+        KirkpatrickSeidelStep step;
+        if constexpr (Recording::enabled)
+        {
+            step.state = context.state;
+            step.type = PAIRS;
+            step.arr.assign(S, S + n);
+            step.hullLineIndex = context.hullLineIndexHelper;
+            step.upperBridgeLineIndex = context.upperBridges.size() - 1;
+            step.lowerBridgeLineIndex = context.lowerBridges.size() - 1;
+
+            for (int i = 0; i < pairCount; i++)
+            {
+                std::pair<int, int> pair = pairAt(i);
+                step.pairs.push_back(S[pair.first]);
+                step.pairs.push_back(S[pair.second]);
+            }
+        }
+
+        // point that could not be paired is added to candidates
+        if (n % 2)
+        {
+            candidates->push_back(S[pairCount]);
+            if constexpr (Recording::enabled)
+            {
+                step.x_m = 1;
+                step.p_k = S[pairCount];
+            }
+        }
+
+        if constexpr (Recording::enabled)
+            context.steps.push_back(step);
+
+        // calculate slopes, vertical pairs only keep their upper point as a candidate
+        int k = 0;
+        scratch.pairSlopes.resize(pairCount);
+        scratch.selectionScratch.resize(pairCount);
+        if (SimdKernels::pairSlopes(S, n, scratch.pairSlopes.data(), ySign) == 0)
+        {
+            std::copy(scratch.pairSlopes.begin(), scratch.pairSlopes.end(), scratch.selectionScratch.begin());
+            k = pairCount;
+        }
+        else
+        {
+            for (int i = 0; i < pairCount; i++)
+            {
+                std::pair<int, int> pair = pairAt(i);
+                if (S[pair.first].x == S[pair.second].x)
+                    candidates->push_back(std::max(S[pair.first], S[pair.second], &compareOriented<Side>));
+                else
+                    scratch.selectionScratch[k++] = scratch.pairSlopes[i];
+            }
+        }
+
+        // get median slope
+        float K = Selection::select(scratch.selectionScratch.data(), k, k / 2 + 1);
+
+        if constexpr (Recording::enabled)
+        {
+            KirkpatrickSeidelStep step4;
+            step4.state = context.state;
+            step4.type = MEDIAN_SLOPE;
+            step4.arr = step.arr;
+            step4.hullLineIndex = context.hullLineIndexHelper;
+            step4.upperBridgeLineIndex = context.upperBridges.size() - 1;
+            step4.lowerBridgeLineIndex = context.lowerBridges.size() - 1;
+            step4.pairs = step.pairs;
+            step4.k = ySign * K;
+            for (int i = 0; i < pairCount; i++)
+            {
+                std::pair<int, int> pair = pairAt(i);
+                if (S[pair.first].x != S[pair.second].x && FloatEquals(scratch.pairSlopes[i], K))
+                {
+                    step4.p_k = S[pair.first];
+                    step4.p_m = S[pair.second];
+                    break;
+                }
+            }
+            context.steps.push_back(step4);
+
+            KirkpatrickSeidelStep step1;
+            step1.state = context.state;
+            step1.type = INTERCEPTS;
+            step1.x_m = L;
+            step1.arr = step.arr;
+            step1.k = ySign * K;
+            step1.upperBridgeLineIndex = context.upperBridges.size() - 1;
+            step1.lowerBridgeLineIndex = context.lowerBridges.size() - 1;
+            step1.hullLineIndex = context.hullLineIndexHelper;
+            context.steps.push_back(step1);
+        }
+
+        // find the points with the largest intercept, keeping the leftmost and rightmost of those tied with it
+        std::pair<int, int> support = SimdKernels::supportingPoints(S, n, K, ySign);
+        Vector2 p_k = S[support.first], p_m = S[support.second];
+
+        // found the winning point
+        if constexpr (Recording::enabled)
+        {
+            KirkpatrickSeidelStep step2;
+            step2.state = context.state;
+            step2.type = INTERCEPTS_FINAL;
+            step2.x_m = L;
+            step2.p_k = p_k;
+            step2.p_m = p_m;
+            step2.k = ySign * K;
+            step2.arr = step.arr;
+            step2.upperBridgeLineIndex = context.upperBridges.size() - 1;
+            step2.lowerBridgeLineIndex = context.lowerBridges.size() - 1;
+            step2.hullLineIndex = context.hullLineIndexHelper;
+            context.steps.push_back(step2);
+        }
+
+        // step 8 in slides
+        if (p_k.x <= L && p_m.x > L)
+            return {p_k, p_m};
+
+        for (int i = 0; i < pairCount; i++)
+        {
+            std::pair<int, int> pair = pairAt(i);
+            if (S[pair.first].x == S[pair.second].x)
+                continue;
+
+            if (p_m.x <= L)
+            {
+                if (scratch.pairSlopes[i] < K)
+                    candidates->push_back(S[pair.first]);
+                candidates->push_back(S[pair.second]);
+            }
+            else if (p_k.x > L)
+            {
+                candidates->push_back(S[pair.first]);
+                if (scratch.pairSlopes[i] > K)
+                    candidates->push_back(S[pair.second]);
+            }
+        }
+
+        // final candidates step
+        if constexpr (Recording::enabled)
+        {
+            KirkpatrickSeidelStep step3;
+            step3.state = context.state;
+            step3.type = ADD_TO_CANDIDATES;
+            step3.arr = *candidates;
+            step3.upperBridgeLineIndex = context.upperBridges.size() - 1;
+            step3.lowerBridgeLineIndex = context.lowerBridges.size() - 1;
+            step3.hullLineIndex = context.hullLineIndexHelper;
+            context.steps.push_back(step3);
+        }
+
+        S = candidates->data();
+        n = candidates->size();
+        std::swap(candidates, nextCandidates);
+    }
+
+    if (n < 2)
+        return {S[0], S[0]};
+    return std::minmax(S[0], S[1], &compareOriented<Side>);
+}
+
+template <typename Recording>
+template <typename KirkpatrickSeidelEngine<Recording>::State Side>
+int KirkpatrickSeidelEngine<Recording>::halfHull(HullContext &context, int begin, int end, Vector2 *out)
+{
+    Vector2 *S = context.work.data() + begin;
+    int n = end - begin;
+    if (isCancelled())
+        return 0;
+    if (n <= 2)
+    {
+        std::sort(S, S + n, &compareOriented<Side>);
+        if constexpr (Recording::enabled)
+        {
+            if (n == 2)
+            {
+                KirkpatrickSeidelStep step2;
+                step2.state = context.state;
+                step2.type = (context.state == UPPER_HULL) ? UP_BRIDGE : LOW_BRIDGE;
+                step2.p_k = S[0];
+                step2.p_m = S[1];
+                step2.upperBridgeLineIndex = context.upperBridges.size() - 1;
+                step2.lowerBridgeLineIndex = context.lowerBridges.size() - 1;
+                step2.hullLineIndex = context.hullLineIndexHelper;
+                context.steps.push_back(step2);
+            }
+        }
+        std::copy(S, S + n, out);
+        return n;
+    }
+
+    // the scratch arrays of the worker are only used until the range is partitioned, so the tasks this worker runs
+    // while waiting for the sub-hulls below can use them again
+    Scratch &scratch = workerScratch[scheduler->getWorkerIndex() + 1];
+
+    // Get x_mid, both middle ranks are found in the same partitioning passes
+    scratch.selectionScratch.resize(n);
+    for (int i = 0; i < n; i++)
+        scratch.selectionScratch[i] = S[i].x;
+    std::pair<float, float> middle =
+        Selection::selectPair(scratch.selectionScratch.data(), n, n / 2 + 1, std::max(1, n / 2));
+    float x_mid = (middle.first + middle.second) / 2;
+    x_mid = x_mid - 0.001; // IMPORTANT
+
+    // drawing the median line is a step
+    if constexpr (Recording::enabled)
+    {
+        KirkpatrickSeidelStep step;
+        step.state = context.state;
+        step.type = LINE;
+        step.x_m = x_mid;
+        step.arr.assign(S, S + n);
+        // step.hullLineIndex = context.hullLineIndexHelper;
+        step.upperBridgeLineIndex = context.upperBridges.size() - 1;
+        step.lowerBridgeLineIndex = context.lowerBridges.size() - 1;
+        context.steps.push_back(step);
+        context.hullLineIndexHelper = context.steps.size() - 1;
+    }
+
+    std::pair<Vector2, Vector2> pq = bridge<Side>(context, scratch, begin, end, x_mid);
+    Vector2 p = pq.first, q = pq.second;
+
+    if constexpr (Recording::enabled)
+    {
+        if (context.state == UPPER_HULL)
+        {
+            context.upperBridges.push_back({p, q});
+        }
+        else if (context.state == LOWER_HULL)
+        {
+            context.lowerBridges.push_back({p, q});
+        }
+
+        // drawing the bridge is a step
+        KirkpatrickSeidelStep step1;
+        step1.state = context.state;
+        step1.type = (context.state == UPPER_HULL) ? UP_BRIDGE : LOW_BRIDGE;
+        step1.p_k = p;
+        step1.p_m = q;
+        step1.upperBridgeLineIndex = context.upperBridges.size() - 1;
+        step1.lowerBridgeLineIndex = context.lowerBridges.size() - 1;
+        step1.hullLineIndex = context.hullLineIndexHelper;
+        context.steps.push_back(step1);
+    }
+
+    // partition the range in place, keeping the relative order of the points, into
+    // [points left of p, p][points right of q, q][co-linear points between p and q]
+    // p and q are two distinct entries of the range that belong to neither part, so everything fits in the range
+    int left = 0;
+    scratch.partitionScratch.clear();
+    Vector2 op = orient<Side>(p), oq = orient<Side>(q);
+    for (int i = 0; i < n; i++)
+    {
+        Vector2 v = S[i], ov = orient<Side>(v);
+        if (v.x < p.x)
+            S[left++] = v;
+        else if (v.x > q.x)
+            scratch.partitionScratch.push_back(v);
+        else if (p.x != q.x && v.x != p.x && v.x != q.x) // co-linear (lies btw p and q) but not vertical
+        {
+            float s1 = (op.y - oq.y) / (op.x - oq.x);
+            float s2 = (op.y - ov.y) / (op.x - ov.x);
+            if (abs(s1 - s2) < 0.0001) // s1 == s2
+                scratch.bridgePoints.push_back(v);
+        }
+        else if (p.x == q.x && v.x == p.x && ov.y > op.y && ov.y < oq.y) // co-linear (lies btw p and q) and vertical
+        {
+            scratch.bridgePoints.push_back(v);
+        }
+    }
+    S[left++] = p;
+    int mid = left;
+    std::copy(scratch.partitionScratch.begin(), scratch.partitionScratch.end(), S + mid);
+    int right = mid + scratch.partitionScratch.size();
+    S[right++] = q;
+    std::copy(scratch.bridgePoints.begin(), scratch.bridgePoints.end(), S + right);
+    int colinearEnd = right + scratch.bridgePoints.size();
+    scratch.bridgePoints.clear();
+
+    std::sort(S + right, S + colinearEnd, &compareOriented<Side>); // O(hlogh)
+
+    // the hulls of both parts are written to the start of their own part of out, since a half hull never has more
+    // points than its range, and the parts never share data, so large ones are computed in parallel
+    int leftCount = 0, rightCount = 0;
+    auto leftHull = [&]() { leftCount = halfHull<Side>(context, begin, begin + mid, out); };
+    auto rightHull = [&]() { rightCount = halfHull<Side>(context, begin + mid, begin + right, out + mid); };
+    if (!Recording::enabled && n >= grainSize)
+        scheduler->invoke(leftHull, rightHull);
+    else
+    {
+        leftHull();
+        rightHull();
+    }
+    if (isCancelled())
+        return 0;
+
+    // join the left hull, p, the co-linear points on the bridge, q and the right hull, moving the right hull to its
+    // place right after the rest
+    int count = leftCount;
+    if (!Vector2Equals(out[count - 1], p))
+        out[count++] = p;
+    int colinearCount = colinearEnd - right;
+    bool addQ = !Vector2Equals(out[mid], q);
+    int rightBegin = count + colinearCount + addQ;
+    if (rightBegin < mid)
+        std::copy(out + mid, out + mid + rightCount, out + rightBegin);
+    else if (rightBegin > mid)
+        std::copy_backward(out + mid, out + mid + rightCount, out + rightBegin + rightCount);
+    std::copy(S + right, S + colinearEnd, out + count); // contains all co-linear points on the bridge
+    if (addQ)
+        out[rightBegin - 1] = q;
+    return rightBegin + rightCount;
+}
+
+template <typename Recording>
+void KirkpatrickSeidelEngine<Recording>::spliceSteps(HullContext &upper, HullContext &lower)
+{
+    // the lower hull steps were recorded without the upper hull steps and bridges before them, so their indices are
+    // shifted past those to match the order of a serial run
+    int upperStepCount = upper.steps.size();
+    steps = std::move(upper.steps);
+    upperBridges = std::move(upper.upperBridges);
+    lowerBridges = std::move(lower.lowerBridges);
+    steps.reserve(steps.size() + lower.steps.size());
+    for (auto &step : lower.steps)
+    {
+        if (step.type != LINE)
+            step.hullLineIndex += upperStepCount;
+        step.upperBridgeLineIndex += upperBridges.size();
+        steps.push_back(std::move(step));
+    }
+}
+
+template <typename Recording>
+std::vector<Vector2> KirkpatrickSeidelEngine<Recording>::convexHull(std::vector<Vector2> &S)
+{
+    if (S.size() <= 2)
+    {
+        currentState = FINISH;
+        if constexpr (Recording::enabled)
+        {
+            KirkpatrickSeidelStep finalStep;
+            finalStep.state = currentState;
+            finalStep.type = OVER;
+            steps.push_back(finalStep);
+        }
+        return S;
+    }
+    std::vector<Vector2> uh, lh, res;
+
+    // the upper and lower hulls are independent of each other until they are merged, so each one is computed in its
+    // own context, on the workers of the scheduler when there are enough points to pay for handing them over
+    HullContext upper, lower;
+    upper.state = UPPER_HULL;
+    lower.state = LOWER_HULL;
+    auto computeUpperHull = [&]() {
+        upper.work = S;
+        uh.resize(S.size());
+        uh.resize(halfHull<UPPER_HULL>(upper, 0, upper.work.size(), uh.data()));
+    };
+    auto computeLowerHull = [&]() {
+        lower.work = S;
+        lh.resize(S.size());
+        lh.resize(halfHull<LOWER_HULL>(lower, 0, lower.work.size(), lh.data()));
+    };
+
+    scheduler = &TaskScheduler::shared();
+    workerScratch.resize(scheduler->getThreadCount() + 1);
+    if (S.size() < grainSize)
+    {
+        computeUpperHull();
+        computeLowerHull();
+    }
+    else
+        scheduler->run([&]() { scheduler->invoke(computeLowerHull, computeUpperHull); });
+
+    if constexpr (Recording::enabled)
+    {
+        upperHullV = uh;
+        spliceSteps(upper, lower);
+    }
+
+    // a cancelled computation leaves the half hulls unfinished, so there is nothing to merge
+    if (isCancelled())
+        return {};
+
+    currentState = MERGE;
+
+    // remove common points (with upper hull) from lower hull where x = x_max, which can empty it when all the points
+    // lie on a vertical line
+    int r = uh.size() - 1;
+    while (r >= 0 && !lh.empty() && Vector2Equals(lh.back(), uh[r]))
+    {
+        lh.pop_back();
+        r--;
+    }
+
+    // at x = x_min, upper hull might have a point (x_min,y1) and lower hull have (x_min,y2)
+    // however, if y1 < y2, we swap the points
+    int s = 0;
+    while (s < lh.size() && s < uh.size() && lh[s].y > uh[s].y)
+    {
+        std::swap(uh[s], lh[s]);
+        s++;
+    }
+
+    // does similar things as the upper block at x = x_max
+    s = 1;
+    while (s <= lh.size() && s <= uh.size() && lh[lh.size() - s].x == uh[uh.size() - s].x &&
+           lh[lh.size() - s].y > uh[uh.size() - s].y)
+    {
+        std::swap(uh[uh.size() - s], lh[lh.size() - s]);
+        s++;
+    }
+
+    reverse(lh.begin(), lh.end()); // to make a chain in final result
+
+    float x_min = std::numeric_limits<float>::infinity();
+    float x_max = -1 * std::numeric_limits<float>::infinity();
+    for (auto v : S)
+    {
+        if (v.x > x_max)
+            x_max = v.x;
+        if (v.x < x_min)
+            x_min = v.x;
+    }
+
+    std::vector<Vector2> temp_res; // stores points vertically co-linear at either ends
+
+    for (auto v : S)
+    {
+        if (v.x == x_max || v.x == x_min)
+            temp_res.push_back(v);
+    }
+    sort(temp_res.begin(), temp_res.end(), &compareVector2);
+
+    // follwing block of code inserts into the result the points which are
+    // vertically co-linear and between the first point in the upper hull and
+    // last point in the (now reversed) lower hull
+    // picture: these three form a vertical line at the left
+    int i = 0;
+    if (temp_res.size() > 2 && !uh.empty() && !lh.empty())
+    {
+        while (i < temp_res.size() && FloatEquals(temp_res[i].x, uh[0].x))
+        {
+            while (i < temp_res.size() && temp_res[i].y < uh[0].y && temp_res[i].y > lh.back().y &&
+                   FloatEquals(temp_res[i].x, uh[0].x))
+            {
+                res.push_back(temp_res[i]);
+                i++;
+            }
+            i++;
+        }
+    }
+
+    // add upper hull to result
+    for (auto v : uh)
+    {
+        if (res.size() == 0 || (res.size() > 0 && !Vector2Equals(res.back(), v)))
+            res.push_back(v);
+    }
+
+    // the following block of code adds to the result, points vertically co-linear and between
+    // the first point in (now reversed) lower hull and last point in upper hull
+    // picture: these three form a vertical line at the right
+    int p = 0;
+    while (i < temp_res.size() && p < lh.size() && !Vector2Equals(temp_res[i], lh[p]))
+    {
+        i++;
+        p++;
+    }
+    if (temp_res.size() > 2 && !uh.empty() && !lh.empty())
+    {
+        while (i < temp_res.size() && temp_res[i].y < uh.back().y && temp_res[i].y > lh[0].y &&
+               temp_res[i].x == lh[0].x)
+        {
+            res.push_back(temp_res[i]);
+            i++;
+        }
+    }
+
+    // add lower hull to the result
+    for (auto v : lh)
+    {
+        if (res.size() == 0 || (res.size() > 0 && !Vector2Equals(res.back(), v)))
+            res.push_back(v);
+    }
+
+    // remove duplicates
+    // example: we remove last 'a' from a->b->c->d->a, but keep the only point when all the points are copies of it
+    while (res.size() > 1 && Vector2Equals(res.front(), res.back()))
+        res.pop_back();
+
+    currentState = FINISH;
+    if constexpr (Recording::enabled)
+    {
+        KirkpatrickSeidelStep finalStep;
+        finalStep.state = currentState;
+        finalStep.type = OVER;
+        steps.push_back(finalStep);
+    }
+    return res;
+}
+
+template class KirkpatrickSeidelEngine<Record>;
+template class KirkpatrickSeidelEngine<NoRecord>;
\ No newline at end of file
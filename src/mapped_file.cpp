@@ -0,0 +1,199 @@
+/**
+ * @file mapped_file.cpp
+ * @brief Contains the implementation of the MappedFile class.
+ *
+ */
+#include "mapped_file.h"
+#include <algorithm>
+#include <cstring>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile()
+{
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+bool MappedFile::open(const std::string &filePath, size_t blockSize)
+{
+    close();
+#if defined(_WIN32)
+    if (blockSize > 0)
+    {
+        stream.open(filePath, std::ios::binary);
+        if (!stream)
+            return false;
+        complete = false;
+        this->blockSize = blockSize;
+        return fill(blockSize);
+    }
+    std::ifstream istream(filePath, std::ios::binary | std::ios::ate);
+    if (!istream)
+        return false;
+    size = istream.tellg();
+    buffer.resize((size + sizeof(double) - 1) / sizeof(double));
+    istream.seekg(0);
+    if (!istream.read(reinterpret_cast<char *>(buffer.data()), size))
+    {
+        close();
+        return false;
+    }
+#else
+    descriptor = ::open(filePath.c_str(), O_RDONLY);
+    if (descriptor == -1)
+        return false;
+    struct stat status;
+    if (fstat(descriptor, &status) == -1)
+    {
+        close();
+        return false;
+    }
+
+    // a pipe or a terminal, such as the standard input, cannot be mapped and is read into memory instead
+    if (!S_ISREG(status.st_mode))
+    {
+        complete = false;
+        this->blockSize = blockSize;
+        return blockSize > 0 ? fill(blockSize) : readRest();
+    }
+
+    // an empty file cannot be mapped, and has nothing to read anyway
+    size = status.st_size;
+    if (size > 0)
+    {
+        mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (mapping == MAP_FAILED)
+        {
+            mapping = nullptr;
+            close();
+            return false;
+        }
+        madvise(mapping, size, MADV_SEQUENTIAL);
+    }
+    ::close(descriptor);
+    descriptor = -1;
+#endif
+    return true;
+}
+
+bool MappedFile::fill(size_t capacity)
+{
+    buffer.resize(std::max(buffer.size(), (capacity + sizeof(double) - 1) / sizeof(double)));
+    char *data = reinterpret_cast<char *>(buffer.data());
+    while (size < capacity)
+    {
+#if defined(_WIN32)
+        stream.read(data + size, capacity - size);
+        size += stream.gcount();
+        if (stream.eof())
+        {
+            stream.close();
+            complete = true;
+            return true;
+        }
+        if (!stream)
+        {
+            close();
+            return false;
+        }
+#else
+        ssize_t count = ::read(descriptor, data + size, capacity - size);
+        if (count == 0)
+        {
+            ::close(descriptor);
+            descriptor = -1;
+            complete = true;
+            return true;
+        }
+        if (count == -1)
+        {
+            close();
+            return false;
+        }
+        size += count;
+#endif
+    }
+    return true;
+}
+
+bool MappedFile::readMore(size_t keep)
+{
+    if (complete)
+        return true;
+    char *data = reinterpret_cast<char *>(buffer.data());
+    std::memmove(data, data + keep, size - keep);
+    size -= keep;
+
+    // a block still full after the drop is grown, so that something is always read
+    return fill(size < blockSize ? blockSize : 2 * size);
+}
+
+bool MappedFile::readRest()
+{
+    while (!complete)
+    {
+        if (!fill(std::max<size_t>(2 * size, 1 << 16)))
+            return false;
+    }
+    return true;
+}
+
+bool MappedFile::isComplete() const
+{
+    return complete;
+}
+
+void MappedFile::close()
+{
+#if defined(_WIN32)
+    stream.close();
+#else
+    if (mapping != nullptr)
+        munmap(mapping, size);
+    if (descriptor != -1)
+        ::close(descriptor);
+    descriptor = -1;
+#endif
+    mapping = nullptr;
+    size = 0;
+    buffer.clear();
+    blockSize = 0;
+    complete = true;
+}
+
+void MappedFile::swap(MappedFile &other)
+{
+    std::swap(mapping, other.mapping);
+    std::swap(size, other.size);
+    buffer.swap(other.buffer);
+    std::swap(blockSize, other.blockSize);
+    std::swap(complete, other.complete);
+#if defined(_WIN32)
+    stream.swap(other.stream);
+#else
+    std::swap(descriptor, other.descriptor);
+#endif
+}
+
+const char *MappedFile::getData() const
+{
+    if (size == 0)
+        return nullptr;
+    if (mapping != nullptr)
+        return static_cast<const char *>(mapping);
+    return reinterpret_cast<const char *>(buffer.data());
+}
+
+size_t MappedFile::getSize() const
+{
+    return size;
+}
\ No newline at end of file
@@ -0,0 +1,259 @@
+/**
+ * @file monotone_chain.cpp
+ * @brief Contains the implementation of the MonotoneChain class.
+ *
+ */
+#include "monotone_chain.h"
+#include "raygui.h"
+
+MonotoneChain::MonotoneChain(std::vector<Vector2> p) : MonotoneChainEngine<Record>(std::move(p))
+{
+}
+
+MonotoneChain::~MonotoneChain()
+{
+}
+
+void MonotoneChain::drawChain(const std::vector<ChainNode> &nodes, int top)
+{
+    for (int i = top; i != -1; i = nodes[i].below)
+    {
+        if (nodes[i].below != -1)
+            DrawLineEx(sorted[nodes[i].pointIndex], sorted[nodes[nodes[i].below].pointIndex], 2, GREEN);
+        DrawCircleV(sorted[nodes[i].pointIndex], 5, BLUE);
+    }
+}
+
+void MonotoneChain::draw()
+{
+    MonotoneChainStep step = steps[currentStep];
+    switch (step.type)
+    {
+    case SORT:
+        // show the order in which the points are swept
+        for (int i = 1; i < static_cast<int>(sorted.size()); i++)
+        {
+            DrawLineV(sorted[i - 1], sorted[i], LIGHTGRAY);
+        }
+        break;
+
+    case POP_UPPER:
+    case PUSH_UPPER:
+    case POP_LOWER:
+    case PUSH_LOWER: {
+        Vector2 p = sorted[step.pointIndex];
+        DrawLineEx({p.x, 70}, {p.x, static_cast<float>(GetScreenHeight()) - 70}, 2, RED);
+        drawChain(upperNodes, step.upperTop);
+        drawChain(lowerNodes, step.lowerTop);
+
+        // after a pop the point is checked against the new top of the chain, which it is joined to after a push
+        int top = (step.type == POP_UPPER || step.type == PUSH_UPPER) ? upperNodes[step.upperTop].pointIndex
+                                                                       : lowerNodes[step.lowerTop].pointIndex;
+        if (step.type == POP_UPPER || step.type == POP_LOWER)
+            DrawLineV(sorted[top], p, ORANGE);
+        DrawCircleV(p, 5, PURPLE);
+    }
+    break;
+
+    case FINISH:
+        // draw the entire hull
+        DrawCircleV(hull[0], 5, BLUE);
+        for (int i = 1; i < static_cast<int>(hull.size()); i++)
+        {
+            DrawLineEx(hull[i], hull[i - 1], 2, GREEN);
+            DrawCircleV(hull[i], 5, BLUE);
+        }
+        if (hull.size() >= 2)
+            DrawLineEx(hull[0], hull.back(), 2, GREEN);
+        break;
+    }
+}
+
+void MonotoneChain::next()
+{
+    if (currentStep < static_cast<int>(steps.size()) - 1)
+        currentStep++;
+}
+
+void MonotoneChain::previous()
+{
+    if (currentStep > 0)
+        currentStep--;
+}
+
+bool MonotoneChain::isFinished()
+{
+    return currentStep >= static_cast<int>(steps.size()) - 1;
+}
+
+int MonotoneChain::getNumberOfSteps()
+{
+    return steps.size();
+}
+
+int MonotoneChain::getCurrentStep()
+{
+    return currentStep;
+}
+
+void MonotoneChain::setCurrentStep(int step)
+{
+    currentStep = step;
+}
+
+std::vector<Vector2> MonotoneChain::exportHull()
+{
+    return hull;
+}
+
+void MonotoneChain::showLegend(bool *showLegend, Vector2 *windowPosition, Vector2 *windowSize, Vector2 *maxWindowSize,
+                               Vector2 *contentSize, Vector2 *scroll, bool *moving, bool *resizing, bool *minimized,
+                               float toolbarHeight, float bottomBarHeight, const char *title)
+{
+    float statusBarHeight = 24.0f, closeButtonSize = 18.0f;
+    if (*showLegend)
+    {
+        int closeTitleSizeDeltaHalf = (statusBarHeight - closeButtonSize) / 2;
+
+        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && !(*moving) && !(*resizing))
+        {
+            Vector2 mousePosition = GetMousePosition();
+
+            Rectangle titleCollisionRect = {(*windowPosition).x, (*windowPosition).y,
+                                            (*windowSize).x - (closeButtonSize + closeTitleSizeDeltaHalf),
+                                            statusBarHeight};
+            Rectangle resizeCollisionRect = {(*windowPosition).x + (*windowSize).x - 20.0f,
+                                             (*windowPosition).y + (*windowSize).y - 20.0f, 20.0f, 20.0f};
+
+            if (CheckCollisionPointRec(mousePosition, titleCollisionRect))
+            {
+                (*moving) = true;
+            }
+            else if (!(*minimized) && CheckCollisionPointRec(mousePosition, resizeCollisionRect))
+            {
+                (*resizing) = true;
+            }
+        }
+
+        if ((*moving))
+        {
+            Vector2 mouseDelta = GetMouseDelta();
+            (*windowPosition).x += mouseDelta.x;
+            (*windowPosition).y += mouseDelta.y;
+
+            if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
+            {
+                (*moving) = false;
+
+                if ((*windowPosition).x < 0.0f)
+                    (*windowPosition).x = 10.0f;
+                else if ((*windowPosition).x > GetScreenWidth() - (*windowSize).x)
+                    (*windowPosition).x = GetScreenWidth() - (*windowSize).x - 10.0f;
+                if ((*windowPosition).y < toolbarHeight)
+                    (*windowPosition).y = toolbarHeight + 10;
+                else if ((*windowPosition).y > GetScreenHeight() - toolbarHeight - bottomBarHeight)
+                    (*windowPosition).y = GetScreenHeight() - bottomBarHeight - statusBarHeight - 10.0f;
+            }
+        }
+        else if ((*resizing))
+        {
+            Vector2 mouseDelta = GetMouseDelta();
+            (*windowSize).x += mouseDelta.x;
+            (*windowSize).y += mouseDelta.y;
+
+            if ((*windowSize).x < 100.0f)
+                (*windowSize).x = 100.0f;
+            else if ((*windowSize).x > GetScreenWidth() - 10.0f)
+                (*windowSize).x = GetScreenWidth() - 10.0f;
+            if ((*windowSize).y < 100.0f)
+                (*windowSize).y = 100.0f;
+            else if ((*windowSize).y > GetScreenHeight() - toolbarHeight - bottomBarHeight - 10.0f)
+                (*windowSize).y = GetScreenHeight() - toolbarHeight - bottomBarHeight - 10.0f;
+
+            if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
+            {
+                (*resizing) = false;
+            }
+        }
+
+        if ((*minimized))
+        {
+            GuiStatusBar((Rectangle){(*windowPosition).x, (*windowPosition).y, (*windowSize).x, statusBarHeight},
+                         title);
+
+            if (GuiButton((Rectangle){(*windowPosition).x + (*windowSize).x - closeButtonSize - closeTitleSizeDeltaHalf,
+                                      (*windowPosition).y + closeTitleSizeDeltaHalf, closeButtonSize, closeButtonSize},
+                          "#120#"))
+            {
+                (*minimized) = false;
+                (*windowSize) = (*maxWindowSize);
+            }
+        }
+        else
+        {
+            (*minimized) = GuiWindowBox(
+                (Rectangle){(*windowPosition).x, (*windowPosition).y, (*windowSize).x, (*windowSize).y}, title);
+            if ((*minimized))
+            {
+                (*windowSize) = {(*maxWindowSize).x, statusBarHeight};
+            }
+
+            Rectangle scissor = {0};
+            GuiScrollPanel((Rectangle){(*windowPosition).x, (*windowPosition).y + statusBarHeight, (*windowSize).x,
+                                       (*windowSize).y - statusBarHeight},
+                           NULL, (Rectangle){(*windowPosition).x, (*windowSize).y, (*contentSize).x, (*contentSize).y},
+                           scroll, &scissor);
+
+            bool requireScissor = (*windowSize).x < (*contentSize).x || (*windowSize).y < (*contentSize).y;
+
+            if (requireScissor)
+            {
+                BeginScissorMode(scissor.x, scissor.y, scissor.width, scissor.height);
+            }
+
+            DrawCircleV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 50.0f + (*scroll).y}, 5,
+                        BLUE);
+            GuiLabel(
+                {(*windowPosition).x + 30.0f + (*scroll).x, (*windowPosition).y + 35.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Convex Hull Point");
+
+            DrawCircleV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 75.0f + (*scroll).y}, 5,
+                        PURPLE);
+            GuiLabel(
+                {(*windowPosition).x + 30.0f + (*scroll).x, (*windowPosition).y + 60.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Current Point");
+
+            DrawLineV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 100.0f + (*scroll).y},
+                      {(*windowPosition).x + 80.0f + (*scroll).x, (*windowPosition).y + 100.0f + (*scroll).y}, GREEN);
+            GuiLabel(
+                {(*windowPosition).x + 90.0f + (*scroll).x, (*windowPosition).y + 85.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Convex Hull Line");
+
+            DrawLineV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 125.0f + (*scroll).y},
+                      {(*windowPosition).x + 80.0f + (*scroll).x, (*windowPosition).y + 125.0f + (*scroll).y}, ORANGE);
+            GuiLabel(
+                {(*windowPosition).x + 90.0f + (*scroll).x, (*windowPosition).y + 110.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Checked Chain Line");
+
+            DrawLineV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 150.0f + (*scroll).y},
+                      {(*windowPosition).x + 80.0f + (*scroll).x, (*windowPosition).y + 150.0f + (*scroll).y}, RED);
+            GuiLabel(
+                {(*windowPosition).x + 90.0f + (*scroll).x, (*windowPosition).y + 135.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Sweep Line");
+
+            DrawLineV({(*windowPosition).x + 20.0f + (*scroll).x, (*windowPosition).y + 175.0f + (*scroll).y},
+                      {(*windowPosition).x + 80.0f + (*scroll).x, (*windowPosition).y + 175.0f + (*scroll).y}, LIGHTGRAY);
+            GuiLabel(
+                {(*windowPosition).x + 90.0f + (*scroll).x, (*windowPosition).y + 160.0f + (*scroll).y, 300.0f, 30.0f},
+                " - Sorted Order");
+
+            if (requireScissor)
+            {
+                EndScissorMode();
+            }
+
+            GuiDrawIcon(71, (*windowPosition).x + (*windowSize).x - 20, (*windowPosition).y + (*windowSize).y - 20, 1,
+                        WHITE);
+        }
+    }
+}
\ No newline at end of file
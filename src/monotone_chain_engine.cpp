@@ -0,0 +1,135 @@
+/**
+ * @file monotone_chain_engine.cpp
+ * @brief Contains the implementation of the MonotoneChainEngine class template.
+ *
+ */
+#include "monotone_chain_engine.h"
+#include <algorithm>
+
+template <typename Recording>
+MonotoneChainEngine<Recording>::MonotoneChainEngine(std::vector<Vector2> p, int grainSize)
+    : grainSize(std::max(2, grainSize))
+{
+    points = std::move(p);
+
+    if (points.size() != 0)
+        computeConvexHull();
+}
+
+template <typename Recording> const std::vector<Vector2> &MonotoneChainEngine<Recording>::getConvexHull() const
+{
+    return hull;
+}
+
+template <typename Recording> bool MonotoneChainEngine<Recording>::wasSorted() const
+{
+    return inputSorted;
+}
+
+template <typename Recording> bool MonotoneChainEngine<Recording>::compareVector2(Vector2 a, Vector2 b)
+{
+    if (a.x == b.x)
+        return a.y < b.y;
+    return a.x < b.x;
+}
+
+template <typename Recording> float MonotoneChainEngine<Recording>::cross(Vector2 o, Vector2 a, Vector2 b)
+{
+    return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+}
+
+template <typename Recording>
+void MonotoneChainEngine<Recording>::parallelSort(Vector2 *begin, Vector2 *end, Vector2 *buffer)
+{
+    if (end - begin < grainSize)
+    {
+        std::sort(begin, end, &compareVector2);
+        return;
+    }
+
+    // the halves are sorted in place, merged into the buffer and copied back, the order being total there is only one
+    // result whatever the number of workers
+    Vector2 *mid = begin + (end - begin) / 2;
+    scheduler->invoke([&]() { parallelSort(begin, mid, buffer); },
+                      [&]() { parallelSort(mid, end, buffer + (mid - begin)); });
+    std::merge(begin, mid, mid, end, buffer, &compareVector2);
+    std::copy(buffer, buffer + (end - begin), begin);
+}
+
+template <typename Recording> void MonotoneChainEngine<Recording>::computeConvexHull()
+{
+    sorted = points;
+    inputSorted = std::is_sorted(sorted.begin(), sorted.end(), &compareVector2);
+    if (!inputSorted)
+    {
+        scheduler = &TaskScheduler::shared();
+        if (static_cast<int>(sorted.size()) < grainSize)
+            std::sort(sorted.begin(), sorted.end(), &compareVector2);
+        else
+        {
+            std::vector<Vector2> buffer(sorted.size());
+            scheduler->run([&]() { parallelSort(sorted.data(), sorted.data() + sorted.size(), buffer.data()); });
+        }
+    }
+    auto same = [](Vector2 a, Vector2 b) { return a.x == b.x && a.y == b.y; };
+    sorted.erase(std::unique(sorted.begin(), sorted.end(), same), sorted.end());
+
+    int n = sorted.size();
+    int upperTop = -1, lowerTop = -1;
+    if constexpr (Recording::enabled)
+        steps.push_back({SORT, -1, upperTop, lowerTop});
+
+    // both chains are built in the same pass, the upper one turning clockwise and the lower one counter-clockwise, and
+    // every chain lives in a buffer of its own that can hold all the points
+    std::vector<Vector2> upper(n), lower(n);
+    int upperCount = 0, lowerCount = 0;
+    for (int i = 0; i < n; i++)
+    {
+        Vector2 p = sorted[i];
+
+        while (upperCount >= 2 && cross(upper[upperCount - 2], upper[upperCount - 1], p) >= 0)
+        {
+            upperCount--;
+            if constexpr (Recording::enabled)
+            {
+                upperTop = upperNodes[upperTop].below;
+                steps.push_back({POP_UPPER, i, upperTop, lowerTop});
+            }
+        }
+        upper[upperCount++] = p;
+        if constexpr (Recording::enabled)
+        {
+            upperNodes.push_back({i, upperTop});
+            upperTop = upperNodes.size() - 1;
+            steps.push_back({PUSH_UPPER, i, upperTop, lowerTop});
+        }
+
+        while (lowerCount >= 2 && cross(lower[lowerCount - 2], lower[lowerCount - 1], p) <= 0)
+        {
+            lowerCount--;
+            if constexpr (Recording::enabled)
+            {
+                lowerTop = lowerNodes[lowerTop].below;
+                steps.push_back({POP_LOWER, i, upperTop, lowerTop});
+            }
+        }
+        lower[lowerCount++] = p;
+        if constexpr (Recording::enabled)
+        {
+            lowerNodes.push_back({i, lowerTop});
+            lowerTop = lowerNodes.size() - 1;
+            steps.push_back({PUSH_LOWER, i, upperTop, lowerTop});
+        }
+    }
+
+    // the chains share their first and last points, which are only taken from the upper chain
+    hull.assign(upper.begin(), upper.begin() + upperCount);
+    for (int i = lowerCount - 2; i > 0; i--)
+        hull.push_back(lower[i]);
+
+    if constexpr (Recording::enabled)
+        steps.push_back({FINISH, -1, upperTop, lowerTop});
+}
+
+template class MonotoneChainEngine<Record>;
+template class MonotoneChainEngine<NoRecord>;
\ No newline at end of file
@@ -0,0 +1,340 @@
+/**
+ * @file point_file_reader.cpp
+ * @brief Contains the implementation of the PointFileReader class.
+ *
+ */
+#include "point_file_reader.h"
+#include "task_scheduler.h"
+#include <algorithm>
+#include <charconv>
+#include <iterator>
+
+PointFileReader::PointFileReader()
+{
+}
+
+PointFileReader::~PointFileReader()
+{
+}
+
+bool PointFileReader::open(const std::string &filePath)
+{
+    close();
+    path = filePath;
+    error.clear();
+    bytesRead = 0;
+    pointsRead = 0;
+    cancelled = false;
+    if (!file.open(filePath, BLOCK_SIZE))
+    {
+        error = path + ": could not open the file";
+        return false;
+    }
+
+    // the magic is checked on the first block, and the whole file is then handed over, since a pipe cannot be read
+    // twice and the two co-ordinate blocks of the binary format are far apart
+    if (BinaryPointFile::isBinaryPointFile(file.getData(), file.getSize()))
+    {
+        if (!file.readRest())
+        {
+            error = path + ": could not read the file";
+            return false;
+        }
+        binary = binaryFile.open(filePath, file);
+        error = binaryFile.getError();
+        size = binaryFile.getSize();
+        return binary;
+    }
+    moveCursor(0);
+    return true;
+}
+
+void PointFileReader::close()
+{
+    file.close();
+    binaryFile.close();
+    binary = false;
+    nextPoint = 0;
+    cursor = {nullptr, nullptr, 1};
+    size = 0;
+}
+
+void PointFileReader::moveCursor(size_t offset)
+{
+    cursor.position = file.getData() + offset;
+    cursor.end = file.getData() + file.getSize();
+    if (file.isComplete())
+        size = bytesRead + (cursor.end - cursor.position);
+}
+
+void PointFileReader::skipSpace(TextCursor &text)
+{
+    while (text.position != text.end)
+    {
+        char c = *text.position;
+        if (c == '\n')
+            text.line++;
+        else if (c != ' ' && c != '\t' && c != '\r')
+            break;
+        text.position++;
+    }
+}
+
+bool PointFileReader::parseNumber(TextCursor &text, float &value)
+{
+    // std::from_chars takes a leading minus sign but not a plus sign
+    const char *first = text.position;
+    if (first != text.end && *first == '+')
+        first++;
+    std::from_chars_result result = std::from_chars(first, text.end, value);
+    if (result.ec != std::errc())
+        return false;
+    text.position = result.ptr;
+    return true;
+}
+
+bool PointFileReader::fail(const TextCursor &text, const char *expected, std::string &message) const
+{
+    message = path + ":" + std::to_string(text.line) + ": expected " + expected + ", found ";
+    if (text.position == file.getData() + file.getSize())
+        message += "the end of the file";
+    else
+        message += std::string("'") + *text.position + "'";
+    return false;
+}
+
+bool PointFileReader::parsePoint(TextCursor &text, Vector2 &p, std::string &message) const
+{
+    if (*text.position != '(')
+        return fail(text, "'('", message);
+    text.position++;
+    skipSpace(text);
+    if (!parseNumber(text, p.x))
+        return fail(text, "the x co-ordinate", message);
+    skipSpace(text);
+    if (text.position == text.end || *text.position != ',')
+        return fail(text, "','", message);
+    text.position++;
+    skipSpace(text);
+    if (!parseNumber(text, p.y))
+        return fail(text, "the y co-ordinate", message);
+    skipSpace(text);
+    if (text.position == text.end || *text.position != ')')
+        return fail(text, "')'", message);
+    text.position++;
+    return true;
+}
+
+int PointFileReader::parseText(TextCursor &text, Vector2 *out, int capacity, std::string &message) const
+{
+    int count = 0;
+    while (count < capacity)
+    {
+        skipSpace(text);
+        if (text.position == text.end)
+            break;
+        if (!parsePoint(text, out[count], message))
+            break;
+        count++;
+    }
+    return count;
+}
+
+int PointFileReader::read(Vector2 *out, int capacity)
+{
+    error.clear();
+    if (binary)
+    {
+        int count = std::min<long long>(capacity, binaryFile.getCount() - nextPoint);
+        binaryFile.readPoints(nextPoint, count, out);
+        nextPoint += count;
+        pointsRead += count;
+        bytesRead = BinaryPointFile::HEADER_SIZE + nextPoint * 2 * binaryFile.getCoordinateType() * sizeof(float);
+        return count;
+    }
+
+    // until the end of the file is held, the text is only parsed up to its last opening parenthesis, which may start a
+    // point cut off by the end of the block, and the next block is read after that point
+    int count = 0;
+    while (true)
+    {
+        TextCursor text = cursor;
+        if (!file.isComplete())
+        {
+            const char *last = std::find(std::make_reverse_iterator(cursor.end),
+                                         std::make_reverse_iterator(cursor.position), '(')
+                                   .base();
+            if (last != cursor.position)
+                text.end = last - 1;
+        }
+        const char *first = text.position;
+        int parsed = parseText(text, out + count, capacity - count, error);
+        count += parsed;
+        pointsRead += parsed;
+        bytesRead += text.position - first;
+        cursor.position = text.position;
+        cursor.line = text.line;
+        if (count == capacity || !error.empty() || file.isComplete())
+            return count;
+        if (!file.readMore(cursor.position - file.getData()))
+        {
+            error = path + ": could not read the file";
+            return count;
+        }
+        moveCursor(0);
+    }
+}
+
+bool PointFileReader::readAll(std::vector<Vector2> &points)
+{
+    error.clear();
+    if (!binary)
+    {
+        // the text is parsed in parallel chunks, so all of it is held
+        if (!file.isComplete())
+        {
+            size_t offset = cursor.position - file.getData();
+            if (!file.readRest())
+            {
+                error = path + ": could not read the file";
+                return false;
+            }
+            moveCursor(offset);
+        }
+        return readAllText(points);
+    }
+
+    // the points are copied a slice at a time so that the progress can be followed and the copy cancelled
+    size_t first = points.size();
+    points.resize(first + (binaryFile.getCount() - nextPoint));
+    for (size_t done = first; done != points.size();)
+    {
+        if (cancelled)
+        {
+            error = path + ": cancelled";
+            points.resize(done);
+            return false;
+        }
+        done += read(points.data() + done, std::min<size_t>(CHUNK_SIZE / sizeof(Vector2), points.size() - done));
+    }
+    // the hull stored after the points is part of the file read
+    bytesRead = binaryFile.getSize();
+    return true;
+}
+
+bool PointFileReader::readAllText(std::vector<Vector2> &points)
+{
+    // the text is cut just before an opening parenthesis, which only ever starts a point, so that every chunk holds
+    // whole points of a valid file
+    std::vector<TextChunk> chunks;
+    for (const char *begin = cursor.position; begin != cursor.end;)
+    {
+        const char *end = cursor.end - begin > CHUNK_SIZE ? std::find(begin + CHUNK_SIZE, cursor.end, '(') : cursor.end;
+        chunks.push_back({begin, end});
+        begin = end;
+    }
+
+    TaskScheduler &scheduler = TaskScheduler::shared();
+    scheduler.parallelFor(0, chunks.size(), [&](int k) {
+        TextChunk &chunk = chunks[k];
+        if (cancelled)
+            return;
+        for (const char *c = chunk.begin; c != chunk.end; c++)
+        {
+            chunk.pointCount += *c == '(';
+            chunk.lineCount += *c == '\n';
+        }
+    });
+    size_t size = points.size();
+    long long line = cursor.line;
+    for (TextChunk &chunk : chunks)
+    {
+        chunk.firstPoint = size;
+        chunk.firstLine = line;
+        size += chunk.pointCount;
+        line += chunk.lineCount;
+    }
+
+    if (cancelled)
+    {
+        error = path + ": cancelled";
+        return false;
+    }
+
+    // every chunk parses its points straight into its own part of the vector
+    points.resize(size);
+    scheduler.parallelFor(0, chunks.size(), [&](int k) {
+        TextChunk &chunk = chunks[k];
+        if (cancelled)
+        {
+            chunk.error = path + ": cancelled";
+            return;
+        }
+        TextCursor text = {chunk.begin, chunk.end, chunk.firstLine};
+        chunk.parsedCount = parseText(text, points.data() + chunk.firstPoint, chunk.pointCount, chunk.error);
+        skipSpace(text);
+        if (chunk.error.empty() && text.position != text.end)
+            fail(text, "'('", chunk.error);
+        bytesRead += chunk.end - chunk.begin;
+        pointsRead += chunk.parsedCount;
+    });
+
+    // the first error in the file is reported, with the points before it
+    for (TextChunk &chunk : chunks)
+    {
+        if (!chunk.error.empty())
+        {
+            error = chunk.error;
+            points.resize(chunk.firstPoint + chunk.parsedCount);
+            return false;
+        }
+    }
+    cursor.position = cursor.end;
+    cursor.line = line;
+    return true;
+}
+
+bool PointFileReader::isAtEnd()
+{
+    if (binary)
+        return nextPoint == binaryFile.getCount();
+    while (true)
+    {
+        skipSpace(cursor);
+        if (cursor.position != cursor.end || file.isComplete())
+            return cursor.position == cursor.end;
+        if (!file.readMore(cursor.position - file.getData()))
+            return false;
+        moveCursor(0);
+    }
+}
+
+void PointFileReader::cancel()
+{
+    cancelled = true;
+}
+
+size_t PointFileReader::getSize() const
+{
+    return size;
+}
+
+size_t PointFileReader::getBytesRead() const
+{
+    return bytesRead;
+}
+
+long long PointFileReader::getPointsRead() const
+{
+    return pointsRead;
+}
+
+const BinaryPointFile *PointFileReader::getBinaryFile() const
+{
+    return binary ? &binaryFile : nullptr;
+}
+
+const std::string &PointFileReader::getError() const
+{
+    return error;
+}
\ No newline at end of file
@@ -0,0 +1,163 @@
+/**
+ * @file point_file_writer.cpp
+ * @brief Contains the implementation of the PointFileWriter class.
+ *
+ */
+#include "point_file_writer.h"
+#include <algorithm>
+#include <charconv>
+
+#if defined(_WIN32)
+#include <cstdio>
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+PointFileWriter::PointFileWriter(Format fileFormat, int digits) : format(fileFormat), precision(digits)
+{
+    // a float has at most 39 digits before the decimal point, and at most 45 zeros after it before its first digit
+    size_t numberLength = precision == SHORTEST ? 64 : 41 + precision;
+    pointLength = 2 * numberLength + 4;
+    clear();
+}
+
+PointFileWriter::~PointFileWriter()
+{
+}
+
+void PointFileWriter::reserve(size_t length)
+{
+    if (buffer.size() - size < length)
+        buffer.resize(std::max(2 * buffer.size(), size + length));
+}
+
+void PointFileWriter::appendNumber(float value)
+{
+    char *end = buffer.data() + buffer.size();
+    std::to_chars_result result = precision == SHORTEST
+                                      ? std::to_chars(buffer.data() + size, end, value, std::chars_format::fixed)
+                                      : std::to_chars(buffer.data() + size, end, value, std::chars_format::fixed,
+                                                      precision);
+    size = result.ptr - buffer.data();
+}
+
+void PointFileWriter::appendPoint(Vector2 p)
+{
+    if (format == TEXT)
+        buffer[size++] = '(';
+    appendNumber(p.x);
+    buffer[size++] = ',';
+    appendNumber(p.y);
+    if (format == TEXT)
+        buffer[size++] = ')';
+    buffer[size++] = '\n';
+}
+
+void PointFileWriter::addPoint(Vector2 p)
+{
+    reserve(pointLength);
+    appendPoint(p);
+}
+
+void PointFileWriter::addPoints(const std::vector<Vector2> &points)
+{
+    reserve(points.size() * pointLength);
+    for (Vector2 p : points)
+    {
+        appendPoint(p);
+    }
+}
+
+void PointFileWriter::addBlankLine()
+{
+    reserve(1);
+    buffer[size++] = '\n';
+}
+
+void PointFileWriter::clear()
+{
+    size = 0;
+    if (format == CSV)
+    {
+        reserve(4);
+        for (char c : {'x', ',', 'y', '\n'})
+            buffer[size++] = c;
+    }
+}
+
+const char *PointFileWriter::getData() const
+{
+    return buffer.data();
+}
+
+size_t PointFileWriter::getSize() const
+{
+    return size;
+}
+
+bool PointFileWriter::save(const std::string &filePath)
+{
+    error.clear();
+#if defined(_WIN32)
+    std::ofstream ostream(filePath, std::ios::binary | std::ios::trunc);
+    if (!ostream)
+    {
+        error = filePath + ": could not open the file";
+        return false;
+    }
+    if (!ostream.write(buffer.data(), size))
+    {
+        error = filePath + ": could not write the file";
+        return false;
+    }
+#else
+    int descriptor = ::open(filePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (descriptor == -1)
+    {
+        error = filePath + ": could not open the file";
+        return false;
+    }
+    bool written = writeAll(descriptor);
+    if (::close(descriptor) == -1 || !written)
+    {
+        error = filePath + ": could not write the file";
+        return false;
+    }
+#endif
+    return true;
+}
+
+bool PointFileWriter::print()
+{
+    error.clear();
+#if defined(_WIN32)
+    bool written = std::fwrite(buffer.data(), 1, size, stdout) == size && std::fflush(stdout) == 0;
+#else
+    bool written = writeAll(STDOUT_FILENO);
+#endif
+    if (!written)
+        error = "the standard output: could not write the points";
+    return written;
+}
+
+#if !defined(_WIN32)
+bool PointFileWriter::writeAll(int descriptor) const
+{
+    // the whole text goes in one call, which is only repeated if the system takes part of it, as a pipe does
+    for (size_t written = 0; written < size;)
+    {
+        ssize_t count = ::write(descriptor, buffer.data() + written, size - written);
+        if (count <= 0)
+            return false;
+        written += count;
+    }
+    return true;
+}
+#endif
+
+const std::string &PointFileWriter::getError() const
+{
+    return error;
+}
\ No newline at end of file
@@ -0,0 +1,186 @@
+/**
+ * @file quick_hull_engine.cpp
+ * @brief Contains the implementation of the QuickHullEngine class template.
+ *
+ */
+#include "quick_hull_engine.h"
+#include <algorithm>
+
+template <typename Recording>
+QuickHullEngine<Recording>::QuickHullEngine(std::vector<Vector2> p, bool keepCollinear, int grainSize)
+    : keepCollinear(keepCollinear), grainSize(std::max(2, grainSize))
+{
+    points = std::move(p);
+
+    if (points.size() != 0)
+        computeConvexHull();
+}
+
+template <typename Recording> const std::vector<Vector2> &QuickHullEngine<Recording>::getConvexHull() const
+{
+    return hull;
+}
+
+template <typename Recording> bool QuickHullEngine<Recording>::compareVector2(Vector2 a, Vector2 b)
+{
+    if (a.x == b.x)
+        return a.y < b.y;
+    return a.x < b.x;
+}
+
+template <typename Recording> float QuickHullEngine<Recording>::cross(Vector2 o, Vector2 a, Vector2 b)
+{
+    return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+}
+
+template <typename Recording> bool QuickHullEngine<Recording>::isBetween(Vector2 p, Vector2 q, Vector2 v)
+{
+    float dx = q.x - p.x, dy = q.y - p.y;
+    return (v.x - p.x) * dx + (v.y - p.y) * dy > 0 && (q.x - v.x) * dx + (q.y - v.y) * dy > 0;
+}
+
+template <typename Recording>
+int QuickHullEngine<Recording>::hullSide(Vector2 p, Vector2 q, int begin, int mid, int end, Vector2 *out)
+{
+    Vector2 *S = work.data();
+
+    // nothing is left of the line, so it is an edge of the hull with only the points on it in between
+    if (begin == mid)
+    {
+        // the points on a line are in the order of their co-ordinates, one way or the other, and duplicates are only
+        // taken once
+        if (compareVector2(p, q))
+            std::sort(S + mid, S + end, &compareVector2);
+        else
+            std::sort(S + mid, S + end, [](Vector2 a, Vector2 b) { return compareVector2(b, a); });
+        auto same = [](Vector2 a, Vector2 b) { return a.x == b.x && a.y == b.y; };
+        int count = std::unique_copy(S + mid, S + end, out, same) - out;
+        if constexpr (Recording::enabled)
+        {
+            edges.push_back({p, q});
+            steps.push_back({EDGE, p, q, q, std::vector<Vector2>(out, out + count), static_cast<int>(edges.size())});
+        }
+        return count;
+    }
+
+    if constexpr (Recording::enabled)
+        steps.push_back({SPLIT, p, q, q, std::vector<Vector2>(S + begin, S + mid), static_cast<int>(edges.size())});
+
+    // of the points furthest from the line, the one furthest towards q is taken, so that c is a corner of the hull even
+    // when an edge of the hull is parallel to the line
+    float dx = q.x - p.x, dy = q.y - p.y;
+    int furthestIndex = begin;
+    float furthestDistance = cross(p, q, S[begin]), furthestAlong = S[begin].x * dx + S[begin].y * dy;
+    for (int i = begin + 1; i < mid; i++)
+    {
+        float distance = cross(p, q, S[i]), along = S[i].x * dx + S[i].y * dy;
+        if (distance > furthestDistance || (distance == furthestDistance && along > furthestAlong))
+        {
+            furthestDistance = distance;
+            furthestAlong = along;
+            furthestIndex = i;
+        }
+    }
+    Vector2 c = S[furthestIndex];
+
+    if constexpr (Recording::enabled)
+        steps.push_back({FURTHEST, p, q, c, std::vector<Vector2>(S + begin, S + mid), static_cast<int>(edges.size())});
+
+    // the points left of the line are partitioned in place into those left of p to c, those on the segment from p to
+    // c, those left of c to q, those on the segment from c to q and those inside the triangle, which are dropped along
+    // with the points on the segment from p to q
+    auto leftOf = [](Vector2 a, Vector2 b) { return [a, b](Vector2 v) { return cross(a, b, v) > 0; }; };
+    auto onSegment = [](Vector2 a, Vector2 b) {
+        return [a, b](Vector2 v) { return cross(a, b, v) == 0 && isBetween(a, b, v); };
+    };
+    Vector2 *leftEnd = std::partition(S + begin, S + mid, leftOf(p, c));
+    Vector2 *leftSegmentEnd = keepCollinear ? std::partition(leftEnd, S + mid, onSegment(p, c)) : leftEnd;
+    Vector2 *rightEnd = std::partition(leftSegmentEnd, S + mid, leftOf(c, q));
+    Vector2 *rightSegmentEnd = keepCollinear ? std::partition(rightEnd, S + mid, onSegment(c, q)) : rightEnd;
+    int leftMid = leftEnd - S, rightBegin = leftSegmentEnd - S, rightMid = rightEnd - S;
+    int rightLast = rightSegmentEnd - S;
+
+    // the hulls of both parts are written to the start of their own part of out, and the parts never share data, so
+    // large ones are computed in parallel
+    int leftCount = 0, rightCount = 0;
+    Vector2 *rightOut = out + (rightBegin - begin);
+    auto leftHull = [&]() { leftCount = hullSide(p, c, begin, leftMid, rightBegin, out); };
+    auto rightHull = [&]() { rightCount = hullSide(c, q, rightBegin, rightMid, rightLast, rightOut); };
+    if (!Recording::enabled && mid - begin >= grainSize)
+        scheduler->invoke(leftHull, rightHull);
+    else
+    {
+        leftHull();
+        rightHull();
+    }
+
+    // join the left hull, c and the right hull, c being dropped from both parts leaves room for it
+    Vector2 *rightTarget = out + leftCount + 1;
+    if (rightTarget < rightOut)
+        std::copy(rightOut, rightOut + rightCount, rightTarget);
+    else if (rightTarget > rightOut)
+        std::copy_backward(rightOut, rightOut + rightCount, rightTarget + rightCount);
+    out[leftCount] = c;
+    return leftCount + 1 + rightCount;
+}
+
+template <typename Recording> void QuickHullEngine<Recording>::computeConvexHull()
+{
+    int n = points.size();
+    Vector2 a = *std::min_element(points.begin(), points.end(), &compareVector2);
+    Vector2 b = *std::max_element(points.begin(), points.end(), &compareVector2);
+
+    if (a.x == b.x && a.y == b.y)
+    {
+        hull.assign(1, a);
+        if constexpr (Recording::enabled)
+            steps.push_back({FINISH, a, b, b, {}, 0});
+        return;
+    }
+
+    // the points above the line from a to b make the upper hull and those below it the lower hull, while the points on
+    // the segment between them are only on the hull when one of the sides is empty
+    work = points;
+    output.resize(n);
+    Vector2 *S = work.data();
+    Vector2 *aboveEnd = std::partition(S, S + n, [&](Vector2 v) { return cross(a, b, v) > 0; });
+    Vector2 *onEnd = aboveEnd;
+    if (keepCollinear)
+        onEnd = std::partition(aboveEnd, S + n, [&](Vector2 v) { return cross(a, b, v) == 0 && isBetween(a, b, v); });
+    Vector2 *belowEnd = std::partition(onEnd, S + n, [&](Vector2 v) { return cross(b, a, v) > 0; });
+
+    int above = aboveEnd - S, on = onEnd - aboveEnd, below = belowEnd - onEnd;
+    int upperEnd = above, lowerBegin = above + on, lowerMid = above + on + below, lowerEnd = lowerMid;
+    if (above == 0)
+        upperEnd = on;
+    else if (below == 0)
+    {
+        lowerBegin = lowerMid = above;
+        lowerEnd = above + on;
+    }
+
+    int upperCount = 0, lowerCount = 0;
+    auto upperHull = [&]() { upperCount = hullSide(a, b, 0, above, upperEnd, output.data()); };
+    auto lowerHull = [&]() { lowerCount = hullSide(b, a, lowerBegin, lowerMid, lowerEnd, output.data() + lowerBegin); };
+    scheduler = &TaskScheduler::shared();
+    if (Recording::enabled || n < grainSize)
+    {
+        upperHull();
+        lowerHull();
+    }
+    else
+        scheduler->run([&]() { scheduler->invoke(upperHull, lowerHull); });
+
+    // the upper hull goes clockwise from a to b and the lower hull from b back to a
+    hull.reserve(upperCount + lowerCount + 2);
+    hull.push_back(a);
+    hull.insert(hull.end(), output.begin(), output.begin() + upperCount);
+    hull.push_back(b);
+    hull.insert(hull.end(), output.begin() + lowerBegin, output.begin() + lowerBegin + lowerCount);
+
+    if constexpr (Recording::enabled)
+        steps.push_back({FINISH, a, b, b, {}, static_cast<int>(edges.size())});
+}
+
+template class QuickHullEngine<Record>;
+template class QuickHullEngine<NoRecord>;
\ No newline at end of file
@@ -0,0 +1,147 @@
+/**
+ * @file selection.cpp
+ * @brief Contains the implementation of the Selection class.
+ *
+ */
+#include "selection.h"
+#include <algorithm>
+
+void Selection::sortFive(float *values)
+{
+    // compare and exchange, compiles down to a min and a max without any branches
+    auto exchange = [values](int i, int j) {
+        float a = values[i], b = values[j];
+        values[i] = std::min(a, b);
+        values[j] = std::max(a, b);
+    };
+    exchange(0, 3);
+    exchange(1, 4);
+    exchange(0, 2);
+    exchange(1, 3);
+    exchange(0, 1);
+    exchange(2, 4);
+    exchange(1, 2);
+    exchange(3, 4);
+    exchange(2, 3);
+}
+
+void Selection::sortSmall(float *values, int n)
+{
+    for (int i = 1; i < n; i++)
+    {
+        float v = values[i];
+        int j = i - 1;
+        while (j >= 0 && values[j] > v)
+        {
+            values[j + 1] = values[j];
+            j--;
+        }
+        values[j + 1] = v;
+    }
+}
+
+void Selection::partition(float *values, int n, float pivot, int &lessEnd, int &greaterBegin)
+{
+    int lt = 0, i = 0, gt = n;
+    while (i < gt)
+    {
+        if (values[i] < pivot)
+            std::swap(values[lt++], values[i++]);
+        else if (values[i] > pivot)
+            std::swap(values[i], values[--gt]);
+        else
+            i++;
+    }
+    lessEnd = lt;
+    greaterBegin = gt;
+}
+
+float Selection::medianOfMedians(float *values, int n)
+{
+    if (n <= SMALL_SIZE)
+    {
+        sortSmall(values, n);
+        return values[(n - 1) / 2];
+    }
+
+    // move the median of every group of five to the front of the array
+    int groups = 0;
+    for (int i = 0; i < n; i += 5, groups++)
+    {
+        int size = std::min(5, n - i);
+        if (size == 5)
+            sortFive(values + i);
+        else
+            sortSmall(values + i, size);
+        std::swap(values[groups], values[i + (size - 1) / 2]);
+    }
+
+    return select(values, groups, (groups + 1) / 2);
+}
+
+float Selection::select(float *values, int n, int rank)
+{
+    if (rank < 1 || n < rank)
+        return 0;
+
+    while (n > SMALL_SIZE)
+    {
+        float pivot = medianOfMedians(values, n);
+        int lessEnd, greaterBegin;
+        partition(values, n, pivot, lessEnd, greaterBegin);
+
+        if (rank <= lessEnd)
+            n = lessEnd;
+        else if (rank <= greaterBegin)
+            return pivot;
+        else
+        {
+            values += greaterBegin;
+            n -= greaterBegin;
+            rank -= greaterBegin;
+        }
+    }
+
+    sortSmall(values, n);
+    return values[rank - 1];
+}
+
+std::pair<float, float> Selection::selectPair(float *values, int n, int firstRank, int secondRank)
+{
+    if (firstRank > secondRank)
+    {
+        std::pair<float, float> swapped = selectPair(values, n, secondRank, firstRank);
+        return {swapped.second, swapped.first};
+    }
+    if (firstRank < 1 || n < secondRank)
+        return {select(values, n, firstRank), select(values, n, secondRank)};
+
+    // both ranks share every pass until the pivot separates them
+    while (n > SMALL_SIZE)
+    {
+        float pivot = medianOfMedians(values, n);
+        int lessEnd, greaterBegin;
+        partition(values, n, pivot, lessEnd, greaterBegin);
+
+        if (secondRank <= lessEnd)
+            n = lessEnd;
+        else if (firstRank > greaterBegin)
+        {
+            values += greaterBegin;
+            n -= greaterBegin;
+            firstRank -= greaterBegin;
+            secondRank -= greaterBegin;
+        }
+        else
+        {
+            float first = (firstRank <= lessEnd) ? select(values, lessEnd, firstRank) : pivot;
+            float second = (secondRank > greaterBegin)
+                               ? select(values + greaterBegin, n - greaterBegin, secondRank - greaterBegin)
+                               : pivot;
+            return {first, second};
+        }
+    }
+
+    sortSmall(values, n);
+    return {values[firstRank - 1], values[secondRank - 1]};
+}
\ No newline at end of file
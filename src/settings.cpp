@@ -18,14 +18,18 @@ Settings::Settings(Vector2 *position, Vector2 *size, Vector2 *contentSz, const c
 
 Settings::~Settings()
 {
+    if (loadingReader)
+        loadingReader->cancel();
 }
 
-void Settings::showSettings(bool *showSettings, float toolbarHeight, float bottomBarHeight, float *scale,
+bool Settings::showSettings(bool *showSettings, float toolbarHeight, float bottomBarHeight, float *scale,
                             float *duration, std::string &filePath, bool *isFilePathAdded, float *numberOfPoints,
                             std::vector<Vector2> &fileDataPoints, std::vector<Vector2> &dataPoints, float &centerX,
                             float &centerY)
 {
     float statusBarHeight = 24.0f, closeButtonSize = 18.0f;
+    bool pointsReplaced = false;
+    pollLoading(isFilePathAdded, filePath, fileDataPoints, scale, toolbarHeight, bottomBarHeight);
     if (*showSettings)
     {
         int closeTitleSizeDeltaHalf = (statusBarHeight - closeButtonSize) / 2;
@@ -125,15 +129,17 @@ void Settings::showSettings(bool *showSettings, float toolbarHeight, float botto
                 BeginScissorMode(scissor.x, scissor.y, scissor.width, scissor.height);
             }
 
-            drawRandomPointGenerationComponent({20.0f, 50.0f}, {windowPosition.x, windowPosition.y}, {500.0f, 200.0f},
-                                               &scroll, toolbarHeight, bottomBarHeight, numberOfPoints, dataPoints);
+            pointsReplaced |= drawRandomPointGenerationComponent({20.0f, 50.0f}, {windowPosition.x, windowPosition.y},
+                                                                 {500.0f, 200.0f}, &scroll, toolbarHeight,
+                                                                 bottomBarHeight, numberOfPoints, dataPoints);
 
             drawScaleComponent({20.0f, 50.0f}, {windowPosition.x, windowPosition.y + 150.0f}, {500.0f, 100.0f}, &scroll,
                                scale);
 
-            drawFileInputComponent({20.0f, 50.0f}, {windowPosition.x, windowPosition.y + 250.0f}, {500.0f, 200.0f},
-                                   &scroll, isFilePathAdded, filePath, fileDataPoints, dataPoints, toolbarHeight,
-                                   bottomBarHeight, scale, scissor, centerX, centerY);
+            pointsReplaced |= drawFileInputComponent({20.0f, 50.0f}, {windowPosition.x, windowPosition.y + 250.0f},
+                                                     {500.0f, 200.0f}, &scroll, isFilePathAdded, filePath,
+                                                     fileDataPoints, dataPoints, toolbarHeight, bottomBarHeight, scale,
+                                                     scissor, centerX, centerY);
 
             drawTimestepComponent({20.0f, 50.0f}, {windowPosition.x, windowPosition.y + 450.0f}, {500.0f, 100.0f},
                                   &scroll, duration);
@@ -146,12 +152,14 @@ void Settings::showSettings(bool *showSettings, float toolbarHeight, float botto
             GuiDrawIcon(71, windowPosition.x + windowSize.x - 20, windowPosition.y + windowSize.y - 20, 1, WHITE);
         }
     }
+    return pointsReplaced;
 }
 
-void Settings::drawRandomPointGenerationComponent(Vector2 padding, Vector2 componentPosition, Vector2 componentSize,
+bool Settings::drawRandomPointGenerationComponent(Vector2 padding, Vector2 componentPosition, Vector2 componentSize,
                                                   Vector2 *scroll, float toolbarHeight, float bottomBarHeight,
                                                   float *numberOfPoints, std::vector<Vector2> &dataPoints)
 {
+    bool pointsReplaced = false;
     GuiLabel((Rectangle){componentPosition.x + padding.x + (*scroll).x, componentPosition.y + padding.y + (*scroll).y,
                          componentSize.x, (0.125f) * componentSize.y},
              "Number of Points");
@@ -178,6 +186,7 @@ void Settings::drawRandomPointGenerationComponent(Vector2 padding, Vector2 compo
                 i++;
             }
         }
+        pointsReplaced = true;
     }
     if (GuiButton((Rectangle){componentPosition.x + padding.x + (*scroll).x + ((0.5f) * componentSize.x),
                               componentPosition.y + padding.y + ((0.375f) * componentSize.y) + (*scroll).y,
@@ -185,7 +194,9 @@ void Settings::drawRandomPointGenerationComponent(Vector2 padding, Vector2 compo
                   "Clear"))
     {
         dataPoints.clear();
+        pointsReplaced = true;
     }
+    return pointsReplaced;
 }
 
 void Settings::drawScaleComponent(Vector2 padding, Vector2 componentPosition, Vector2 componentSize, Vector2 *scroll,
@@ -200,12 +211,13 @@ void Settings::drawScaleComponent(Vector2 padding, Vector2 componentPosition, Ve
               NULL, TextFormat("%0.1f", *scale), scale, 0.1f, 50.0f);
 }
 
-void Settings::drawFileInputComponent(Vector2 padding, Vector2 componentPosition, Vector2 componentSize,
+bool Settings::drawFileInputComponent(Vector2 padding, Vector2 componentPosition, Vector2 componentSize,
                                       Vector2 *scroll, bool *isFilePathAdded, std::string &filePath,
                                       std::vector<Vector2> &fileDataPoints, std::vector<Vector2> &dataPoints,
                                       float toolbarHeight, float bottomBarHeight, float *scale, Rectangle scissor,
                                       float &centerX, float &centerY)
 {
+    bool pointsReplaced = false;
     if (*isFilePathAdded == 0)
     {
         GuiLabel((Rectangle){componentPosition.x + padding.x + (*scroll).x,
@@ -215,6 +227,13 @@ void Settings::drawFileInputComponent(Vector2 padding, Vector2 componentPosition
         DrawRectangle(componentPosition.x + padding.x + (*scroll).x,
                       componentPosition.y + padding.y + ((0.25f) * componentSize.y) + (*scroll).y, componentSize.x,
                       (0.5f) * componentSize.y, Fade(LIGHTGRAY, 0.3f));
+        if (!fileError.empty())
+        {
+            GuiLabel((Rectangle){componentPosition.x + padding.x + (*scroll).x,
+                                 componentPosition.y + padding.y + ((0.75f) * componentSize.y) + (*scroll).y,
+                                 componentSize.x, (0.125f) * componentSize.y},
+                     fileError.c_str());
+        }
 
         if (IsFileDropped())
         {
@@ -233,19 +252,7 @@ void Settings::drawFileInputComponent(Vector2 padding, Vector2 componentPosition
                                          componentSize.x + (padding.x - xGap) + (*scroll).x),
                                 std::min(scissor.height - (yCoord - scissor.y), ((0.5f) * componentSize.y) + yGap)}))
             {
-                filePath = std::string(droppedFile.paths[0]);
-                *isFilePathAdded = 1;
-
-                fileDataPoints.clear();
-                std::ifstream istream(filePath);
-                float x, y;
-                char openParenthesis, closeParenthesis, separator;
-                while (istream >> openParenthesis >> x >> separator >> y >> closeParenthesis)
-                {
-                    fileDataPoints.push_back({x, y});
-                }
-
-                computeScale(fileDataPoints, scale, toolbarHeight, bottomBarHeight);
+                startLoading(droppedFile.paths[0], isFilePathAdded, filePath, fileDataPoints);
             }
 
             UnloadDroppedFiles(droppedFile);
@@ -264,6 +271,12 @@ void Settings::drawFileInputComponent(Vector2 padding, Vector2 componentPosition
                              componentPosition.y + padding.y + ((0.25f) * componentSize.y) + (*scroll).y,
                              componentSize.x, (0.125f) * componentSize.y},
                  filePath.c_str());
+
+        // the points cannot be drawn before all of them have been read
+        if (loadingReader)
+        {
+            GuiDisable();
+        }
         if (GuiButton((Rectangle){componentPosition.x + padding.x + (*scroll).x,
                                   componentPosition.y + padding.y + ((0.5f) * componentSize.y) + (*scroll).y,
                                   (0.4f) * componentSize.x, (0.125f) * componentSize.y},
@@ -272,32 +285,52 @@ void Settings::drawFileInputComponent(Vector2 padding, Vector2 componentPosition
             if (fileDataPoints.size() > 0)
             {
                 dataPoints.clear();
-                float smallestX = fileDataPoints[0].x, smallestY = fileDataPoints[0].y;
-                for (auto &point : fileDataPoints)
-                {
-                    smallestX = std::min(smallestX, point.x);
-                    smallestY = std::min(smallestY, point.y);
-                }
-                centerX = smallestX;
-                centerY = smallestY;
+                centerX = loadedMin.x;
+                centerY = loadedMin.y;
 
                 for (auto &point : fileDataPoints)
                 {
                     dataPoints.push_back({(point.x - centerX) * (*scale) + 25.0f,
                                           (point.y - centerY) * (*scale) + toolbarHeight + 25.0f});
                 }
+                pointsReplaced = true;
             }
         }
-        if (GuiButton((Rectangle){componentPosition.x + padding.x + (*scroll).x + ((0.5f) * componentSize.x),
-                                  componentPosition.y + padding.y + ((0.5f) * componentSize.y) + (*scroll).y,
-                                  (0.4f) * componentSize.x, (0.125f) * componentSize.y},
-                      "Clear"))
+        GuiEnable();
+
+        if (loadingReader)
+        {
+            // the load is only asked to stop here, the file is dropped once it has
+            if (GuiButton((Rectangle){componentPosition.x + padding.x + (*scroll).x + ((0.5f) * componentSize.x),
+                                      componentPosition.y + padding.y + ((0.5f) * componentSize.y) + (*scroll).y,
+                                      (0.4f) * componentSize.x, (0.125f) * componentSize.y},
+                          "Cancel"))
+            {
+                loadingReader->cancel();
+            }
+
+            float progress = loadingReader->getSize() > 0
+                                 ? static_cast<float>(loadingReader->getBytesRead()) / loadingReader->getSize()
+                                 : 1.0f;
+            GuiProgressBar((Rectangle){componentPosition.x + padding.x + (*scroll).x,
+                                       componentPosition.y + padding.y + ((0.75f) * componentSize.y) + (*scroll).y,
+                                       (0.4f) * componentSize.x, (0.125f) * componentSize.y},
+                           NULL,
+                           TextFormat("%.1f of %.1f MB, %lld points", loadingReader->getBytesRead() / 1048576.0,
+                                      loadingReader->getSize() / 1048576.0, loadingReader->getPointsRead()),
+                           &progress, 0.0f, 1.0f);
+        }
+        else if (GuiButton((Rectangle){componentPosition.x + padding.x + (*scroll).x + ((0.5f) * componentSize.x),
+                                       componentPosition.y + padding.y + ((0.5f) * componentSize.y) + (*scroll).y,
+                                       (0.4f) * componentSize.x, (0.125f) * componentSize.y},
+                           "Clear"))
         {
             *isFilePathAdded = false;
             filePath.clear();
             fileDataPoints.clear();
         }
     }
+    return pointsReplaced;
 }
 
 void Settings::drawTimestepComponent(Vector2 padding, Vector2 componentPosition, Vector2 componentSize, Vector2 *scroll,
@@ -312,30 +345,93 @@ void Settings::drawTimestepComponent(Vector2 padding, Vector2 componentPosition,
               NULL, TextFormat("%0.2f", *duration), duration, 0.01f, 0.50f);
 }
 
-void Settings::computeScale(std::vector<Vector2> &fileDataPoints, float *scale, float toolbarHeight,
+void Settings::computeScale(Vector2 smallest, Vector2 largest, float *scale, float toolbarHeight,
                             float bottomBarHeight)
 {
-    if (fileDataPoints.size() > 0)
+    float computedScale = 50.0f;
+    while ((largest.x - smallest.x) * computedScale > (static_cast<float>(GetScreenWidth()) - 50.0f) ||
+           (largest.y - smallest.y) * computedScale >
+               (static_cast<float>(GetScreenHeight()) - toolbarHeight - bottomBarHeight - 50.0f))
     {
-        float smallestX = fileDataPoints[0].x, largestX = fileDataPoints[0].x, smallestY = fileDataPoints[0].y,
-              largestY = fileDataPoints[0].y;
-        for (auto &point : fileDataPoints)
+        computedScale -= 0.1f;
+    }
+    *scale = computedScale;
+}
+
+void Settings::startLoading(const char *path, bool *isFilePathAdded, std::string &filePath,
+                            std::vector<Vector2> &fileDataPoints)
+{
+    // a file dropped while another one loads replaces it
+    if (loadingReader)
+    {
+        loadingReader->cancel();
+        loading.wait();
+    }
+    fileDataPoints.clear();
+    loadingPoints.clear();
+    fileError.clear();
+    loadingReader = std::make_unique<PointFileReader>();
+    if (!loadingReader->open(path))
+    {
+        fileError = loadingReader->getError();
+        loadingReader.reset();
+        return;
+    }
+    filePath = std::string(path);
+    *isFilePathAdded = 1;
+
+#if defined(PLATFORM_WEB)
+    std::launch policy = std::launch::deferred;
+#else
+    std::launch policy = std::launch::async;
+#endif
+    loading = std::async(policy, [this]() {
+        if (!loadingReader->readAll(loadingPoints))
+            return false;
+
+        // a binary file holds the bounding box of its points in its header
+        if (const BinaryPointFile *binaryFile = loadingReader->getBinaryFile())
         {
-            smallestX = std::min(smallestX, point.x);
-            largestX = std::max(largestX, point.x);
-            smallestY = std::min(smallestY, point.y);
-            largestY = std::max(largestY, point.y);
+            loadedMin = binaryFile->getMin();
+            loadedMax = binaryFile->getMax();
         }
-
-        float computedScale = 50.0f;
-        while ((largestX - smallestX) * computedScale > (static_cast<float>(GetScreenWidth()) - 50.0f) ||
-               (largestY - smallestY) * computedScale >
-                   (static_cast<float>(GetScreenHeight()) - toolbarHeight - bottomBarHeight - 50.0f))
+        else if (loadingPoints.size() > 0)
         {
-            computedScale -= 0.1f;
+            loadedMin = loadedMax = loadingPoints[0];
+            for (auto &point : loadingPoints)
+            {
+                loadedMin.x = std::min(loadedMin.x, point.x);
+                loadedMax.x = std::max(loadedMax.x, point.x);
+                loadedMin.y = std::min(loadedMin.y, point.y);
+                loadedMax.y = std::max(loadedMax.y, point.y);
+            }
         }
-        *scale = computedScale;
+        return true;
+    });
+}
+
+void Settings::pollLoading(bool *isFilePathAdded, std::string &filePath, std::vector<Vector2> &fileDataPoints,
+                           float *scale, float toolbarHeight, float bottomBarHeight)
+{
+    // a deferred load is run by taking it
+    if (!loading.valid() || loading.wait_for(std::chrono::seconds(0)) == std::future_status::timeout)
+        return;
+
+    // a file that does not follow the format is not loaded, and the reason is shown instead
+    if (loading.get())
+    {
+        fileDataPoints = std::move(loadingPoints);
+        if (fileDataPoints.size() > 0)
+            computeScale(loadedMin, loadedMax, scale, toolbarHeight, bottomBarHeight);
+    }
+    else
+    {
+        *isFilePathAdded = 0;
+        filePath.clear();
+        fileError = loadingReader->getError();
     }
+    loadingPoints = std::vector<Vector2>();
+    loadingReader.reset();
 }
 
 bool Settings::checkPointValidity(Vector2 p, bool *showSettings)
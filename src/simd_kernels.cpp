@@ -0,0 +1,287 @@
+/**
+ * @file simd_kernels.cpp
+ * @brief Contains the implementation of the SimdKernels class.
+ *
+ */
+#include "simd_kernels.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)) &&                       \
+    !defined(PLATFORM_WEB)
+#define SIMD_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+namespace
+{
+/**
+ * @brief The versions of the kernels picked for this CPU.
+ *
+ */
+struct KernelTable
+{
+    int (*pairSlopes)(const Vector2 *, int, float *, float);
+    std::pair<int, int> (*supportingPoints)(const Vector2 *, int, float, float);
+    const char *name;
+};
+
+/**
+ * @brief The largest value SimdKernels::tolerance() returns, so a point whose intercept is further below the running
+ * maximum than this can neither replace it nor be tied with it.
+ *
+ */
+const float LARGEST_TOLERANCE = 0.01f;
+
+/**
+ * @brief Represents the state of the search for the supporting points, carried from one group of points to the next.
+ *
+ */
+struct Support
+{
+    /**
+     * @brief The running maximum of the intercepts.
+     *
+     */
+    float intercept = -std::numeric_limits<float>::infinity();
+    /**
+     * @brief The index of the leftmost point tied with the running maximum, or -1.
+     *
+     */
+    int left = -1;
+    /**
+     * @brief The index of the rightmost point tied with the running maximum, or -1.
+     *
+     */
+    int right = -1;
+};
+
+// the scalar versions also finish off the points left over by the vector versions, starting from begin
+
+int pairSlopesScalar(const Vector2 *points, int n, float *slopes, float ySign, int begin)
+{
+    int vertical = 0;
+    for (int i = begin; i < n / 2; i++)
+    {
+        Vector2 a = {points[i].x, ySign * points[i].y}, b = {points[n - 1 - i].x, ySign * points[n - 1 - i].y};
+        if (a.x > b.x)
+            std::swap(a, b);
+        if (a.x == b.x)
+            vertical++;
+        slopes[i] = (a.y - b.y) / (a.x - b.x);
+    }
+    return vertical;
+}
+
+void supportingPointsScalar(const Vector2 *points, int begin, int end, float slope, float ySign, Support &support)
+{
+    for (int i = begin; i < end; i++)
+    {
+        float intercept = ySign * points[i].y - slope * points[i].x;
+        if (intercept - support.intercept > SimdKernels::tolerance(intercept, support.intercept))
+        {
+            support.intercept = intercept;
+            support.left = support.right = i;
+        }
+        else if (std::abs(intercept - support.intercept) <= SimdKernels::tolerance(intercept, support.intercept))
+        {
+            if (points[i].x > points[support.right].x)
+                support.right = i;
+            else if (points[i].x < points[support.left].x)
+                support.left = i;
+        }
+    }
+}
+
+int pairSlopesScalar(const Vector2 *points, int n, float *slopes, float ySign)
+{
+    return pairSlopesScalar(points, n, slopes, ySign, 0);
+}
+
+std::pair<int, int> supportingPointsScalar(const Vector2 *points, int n, float slope, float ySign)
+{
+    Support support;
+    supportingPointsScalar(points, 0, n, slope, ySign, support);
+    return {support.left, support.right};
+}
+
+#if defined(SIMD_KERNELS_X86)
+
+// AVX2 versions, working on eight points at a time
+
+__attribute__((target("avx2"))) inline void loadPoints8(const Vector2 *points, __m256 ySign, __m256 &x, __m256 &y)
+{
+    __m256 a = _mm256_loadu_ps(reinterpret_cast<const float *>(points));
+    __m256 b = _mm256_loadu_ps(reinterpret_cast<const float *>(points + 4));
+    // the shuffles work within 128 bit halves, leaving the points in the order 0 1 4 5 2 3 6 7
+    __m256 xs = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 ys = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+    x = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(xs), _MM_SHUFFLE(3, 1, 2, 0)));
+    y = _mm256_mul_ps(ySign, _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(ys), _MM_SHUFFLE(3, 1, 2, 0))));
+}
+
+__attribute__((target("avx2"))) int pairSlopesAvx2(const Vector2 *points, int n, float *slopes, float ySign)
+{
+    const __m256 sign = _mm256_set1_ps(ySign);
+    const __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    int i = 0, vertical = 0;
+    for (; i + 8 <= n / 2; i += 8)
+    {
+        __m256 frontX, frontY, backX, backY;
+        loadPoints8(points + i, sign, frontX, frontY);
+        loadPoints8(points + n - 8 - i, sign, backX, backY);
+        backX = _mm256_permutevar8x32_ps(backX, reverse);
+        backY = _mm256_permutevar8x32_ps(backY, reverse);
+        // put the point with the smaller x first, which fixes the sign of the slope of horizontal pairs
+        __m256 swap = _mm256_cmp_ps(frontX, backX, _CMP_GT_OQ);
+        __m256 firstX = _mm256_blendv_ps(frontX, backX, swap), secondX = _mm256_blendv_ps(backX, frontX, swap);
+        __m256 firstY = _mm256_blendv_ps(frontY, backY, swap), secondY = _mm256_blendv_ps(backY, frontY, swap);
+        _mm256_storeu_ps(slopes + i, _mm256_div_ps(_mm256_sub_ps(firstY, secondY), _mm256_sub_ps(firstX, secondX)));
+        vertical += __builtin_popcount(_mm256_movemask_ps(_mm256_cmp_ps(frontX, backX, _CMP_EQ_OQ)));
+    }
+    return vertical + pairSlopesScalar(points, n, slopes, ySign, i);
+}
+
+__attribute__((target("avx2"))) std::pair<int, int> supportingPointsAvx2(const Vector2 *points, int n, float slope,
+                                                                          float ySign)
+{
+    const __m256 k = _mm256_set1_ps(slope), sign = _mm256_set1_ps(ySign);
+    const __m256 margin = _mm256_set1_ps(-LARGEST_TOLERANCE);
+    Support support;
+    int i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        // the scalar version only goes over the points if one of them is close enough to the running maximum
+        __m256 x, y;
+        loadPoints8(points + i, sign, x, y);
+        __m256 difference = _mm256_sub_ps(_mm256_sub_ps(y, _mm256_mul_ps(k, x)), _mm256_set1_ps(support.intercept));
+        if (_mm256_movemask_ps(_mm256_cmp_ps(difference, margin, _CMP_GE_OQ)) != 0)
+            supportingPointsScalar(points, i, i + 8, slope, ySign, support);
+    }
+    supportingPointsScalar(points, i, n, slope, ySign, support);
+    return {support.left, support.right};
+}
+
+// SSE4.1 versions, working on four points at a time
+
+__attribute__((target("sse4.1"))) inline void loadPoints4(const Vector2 *points, __m128 ySign, __m128 &x, __m128 &y)
+{
+    __m128 a = _mm_loadu_ps(reinterpret_cast<const float *>(points));
+    __m128 b = _mm_loadu_ps(reinterpret_cast<const float *>(points + 2));
+    x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+    y = _mm_mul_ps(ySign, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+__attribute__((target("sse4.1"))) int pairSlopesSse41(const Vector2 *points, int n, float *slopes, float ySign)
+{
+    const __m128 sign = _mm_set1_ps(ySign);
+    int i = 0, vertical = 0;
+    for (; i + 4 <= n / 2; i += 4)
+    {
+        __m128 frontX, frontY, backX, backY;
+        loadPoints4(points + i, sign, frontX, frontY);
+        loadPoints4(points + n - 4 - i, sign, backX, backY);
+        backX = _mm_shuffle_ps(backX, backX, _MM_SHUFFLE(0, 1, 2, 3));
+        backY = _mm_shuffle_ps(backY, backY, _MM_SHUFFLE(0, 1, 2, 3));
+        __m128 swap = _mm_cmpgt_ps(frontX, backX);
+        __m128 firstX = _mm_blendv_ps(frontX, backX, swap), secondX = _mm_blendv_ps(backX, frontX, swap);
+        __m128 firstY = _mm_blendv_ps(frontY, backY, swap), secondY = _mm_blendv_ps(backY, frontY, swap);
+        _mm_storeu_ps(slopes + i, _mm_div_ps(_mm_sub_ps(firstY, secondY), _mm_sub_ps(firstX, secondX)));
+        vertical += __builtin_popcount(_mm_movemask_ps(_mm_cmpeq_ps(frontX, backX)));
+    }
+    return vertical + pairSlopesScalar(points, n, slopes, ySign, i);
+}
+
+__attribute__((target("sse4.1"))) std::pair<int, int> supportingPointsSse41(const Vector2 *points, int n,
+                                                                             float slope, float ySign)
+{
+    const __m128 k = _mm_set1_ps(slope), sign = _mm_set1_ps(ySign), margin = _mm_set1_ps(-LARGEST_TOLERANCE);
+    Support support;
+    int i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 x, y;
+        loadPoints4(points + i, sign, x, y);
+        __m128 difference = _mm_sub_ps(_mm_sub_ps(y, _mm_mul_ps(k, x)), _mm_set1_ps(support.intercept));
+        if (_mm_movemask_ps(_mm_cmpge_ps(difference, margin)) != 0)
+            supportingPointsScalar(points, i, i + 4, slope, ySign, support);
+    }
+    supportingPointsScalar(points, i, n, slope, ySign, support);
+    return {support.left, support.right};
+}
+
+#endif
+
+/**
+ * @brief Picks the versions of the kernels for the CPU running the program.
+ *
+ * @return KernelTable The kernels.
+ */
+KernelTable pickKernels()
+{
+#if defined(SIMD_KERNELS_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return {pairSlopesAvx2, supportingPointsAvx2, "avx2"};
+    if (__builtin_cpu_supports("sse4.1"))
+        return {pairSlopesSse41, supportingPointsSse41, "sse4.1"};
+#endif
+    return {pairSlopesScalar, supportingPointsScalar, "scalar"};
+}
+
+KernelTable &kernels()
+{
+    static KernelTable table = pickKernels();
+    return table;
+}
+} // namespace
+
+int SimdKernels::pairSlopes(const Vector2 *points, int n, float *slopes, float ySign)
+{
+    return kernels().pairSlopes(points, n, slopes, ySign);
+}
+
+std::pair<int, int> SimdKernels::supportingPoints(const Vector2 *points, int n, float slope, float ySign)
+{
+    return kernels().supportingPoints(points, n, slope, ySign);
+}
+
+float SimdKernels::tolerance(float a, float b)
+{
+    float m = std::max(std::abs(a), std::abs(b));
+    if (m <= 500)
+        return 0.0001;
+    else if (m <= 5000)
+        return 0.001;
+    return 0.01;
+}
+
+const char *SimdKernels::getInstructionSet()
+{
+    return kernels().name;
+}
+
+bool SimdKernels::useInstructionSet(const char *name)
+{
+    KernelTable &table = kernels();
+#if defined(SIMD_KERNELS_X86)
+    if (std::strcmp(name, "avx2") == 0 && __builtin_cpu_supports("avx2"))
+    {
+        table = {pairSlopesAvx2, supportingPointsAvx2, "avx2"};
+        return true;
+    }
+    if (std::strcmp(name, "sse4.1") == 0 && __builtin_cpu_supports("sse4.1"))
+    {
+        table = {pairSlopesSse41, supportingPointsSse41, "sse4.1"};
+        return true;
+    }
+#endif
+    if (std::strcmp(name, "scalar") == 0)
+    {
+        table = {pairSlopesScalar, supportingPointsScalar, "scalar"};
+        return true;
+    }
+    return false;
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+/**
+ * @file streaming_hull.cpp
+ * @brief Contains the implementation of the StreamingHull class.
+ *
+ */
+#include "streaming_hull.h"
+#include "hull_prefilter.h"
+#include "monotone_chain_engine.h"
+#include "point_file_reader.h"
+#include <algorithm>
+
+StreamingHull::StreamingHull(int chunkSize) : chunkSize(std::max(1, chunkSize))
+{
+    chunk.reserve(this->chunkSize);
+}
+
+void StreamingHull::add(Vector2 p)
+{
+    chunk.push_back(p);
+    pointCount++;
+    if (static_cast<int>(chunk.size()) == chunkSize)
+        fold();
+}
+
+bool StreamingHull::addFile(const std::string &filePath)
+{
+    PointFileReader reader;
+    if (!reader.open(filePath))
+    {
+        error = reader.getError();
+        return false;
+    }
+
+    // the points are parsed straight into the room left in the chunk
+    while (true)
+    {
+        int size = chunk.size();
+        chunk.resize(chunkSize);
+        int count = reader.read(chunk.data() + size, chunkSize - size);
+        chunk.resize(size + count);
+        pointCount += count;
+        if (static_cast<int>(chunk.size()) == chunkSize)
+            fold();
+        else
+            break;
+    }
+    error = reader.getError();
+    return error.empty();
+}
+
+const std::string &StreamingHull::getError() const
+{
+    return error;
+}
+
+const std::vector<Vector2> &StreamingHull::getConvexHull()
+{
+    if (!chunk.empty())
+        fold();
+    return hull;
+}
+
+long long StreamingHull::getPointCount() const
+{
+    return pointCount;
+}
+
+void StreamingHull::fold()
+{
+    // the chunk is filtered before the hull so far joins it, as the hull points would all be kept anyway
+    HullPrefilter prefilter;
+    std::vector<Vector2> points = prefilter.filter(chunk);
+    points.insert(points.end(), hull.begin(), hull.end());
+    hull = MonotoneChainEngine<NoRecord>(std::move(points)).getConvexHull();
+    chunk.clear();
+}
\ No newline at end of file
@@ -0,0 +1,156 @@
+/**
+ * @file task_scheduler.cpp
+ * @brief Contains the implementation of the TaskScheduler class.
+ *
+ */
+#include "task_scheduler.h"
+#include <algorithm>
+
+thread_local TaskScheduler *TaskScheduler::currentScheduler = nullptr;
+thread_local int TaskScheduler::currentWorkerIndex = -1;
+
+namespace
+{
+std::mutex sharedMutex;
+std::unique_ptr<TaskScheduler> sharedScheduler;
+int sharedThreadCount = 0;
+} // namespace
+
+TaskScheduler::TaskScheduler(int threadCount)
+{
+#if !defined(PLATFORM_WEB)
+    if (threadCount <= 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    for (int i = 0; i < threadCount; i++)
+        workers.push_back(std::make_unique<Worker>());
+    // the threads are only started once every worker exists, since any of them may steal from all the others
+    for (int i = 0; i < threadCount; i++)
+        workers[i]->thread = std::thread(&TaskScheduler::workerLoop, this, i);
+#endif
+}
+
+TaskScheduler::~TaskScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    taskQueued.notify_all();
+    for (auto &worker : workers)
+        worker->thread.join();
+}
+
+int TaskScheduler::getThreadCount() const
+{
+    return std::max<int>(1, workers.size());
+}
+
+int TaskScheduler::getWorkerIndex() const
+{
+    return currentScheduler == this ? currentWorkerIndex : -1;
+}
+
+TaskScheduler &TaskScheduler::shared()
+{
+    std::lock_guard<std::mutex> lock(sharedMutex);
+    if (!sharedScheduler)
+        sharedScheduler = std::make_unique<TaskScheduler>(sharedThreadCount);
+    return *sharedScheduler;
+}
+
+void TaskScheduler::setSharedThreadCount(int threadCount)
+{
+    std::lock_guard<std::mutex> lock(sharedMutex);
+    sharedThreadCount = threadCount;
+    sharedScheduler.reset();
+}
+
+void TaskScheduler::execute(const Task &task)
+{
+    try
+    {
+        task.call(task.callable);
+    }
+    catch (...)
+    {
+        *task.error = std::current_exception();
+    }
+
+    // the waiting thread may return as soon as it sees the counter drop, so nothing of the task is touched afterwards
+    if (task.submitted)
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        task.pending->fetch_sub(1, std::memory_order_release);
+        taskFinished.notify_all();
+    }
+    else
+        task.pending->fetch_sub(1, std::memory_order_release);
+}
+
+void TaskScheduler::push(int workerIndex, const Task &task)
+{
+    {
+        std::lock_guard<std::mutex> lock(workers[workerIndex]->mutex);
+        workers[workerIndex]->tasks.push_back(task);
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        queuedTasks++;
+    }
+    taskQueued.notify_one();
+}
+
+bool TaskScheduler::runOne(int workerIndex)
+{
+    int workerCount = workers.size();
+    for (int i = 0; i < workerCount; i++)
+    {
+        // look at the own queue first, then at the others starting from the next worker
+        Worker &victim = *workers[(workerIndex + i) % workerCount];
+        Task task;
+        {
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.tasks.empty())
+                continue;
+            if (i == 0)
+            {
+                task = victim.tasks.back();
+                victim.tasks.pop_back();
+            }
+            else
+            {
+                task = victim.tasks.front();
+                victim.tasks.pop_front();
+            }
+        }
+        queuedTasks--;
+        execute(task);
+        return true;
+    }
+    return false;
+}
+
+void TaskScheduler::waitFor(int workerIndex, std::atomic<int> &pending)
+{
+    while (pending.load(std::memory_order_acquire) != 0)
+    {
+        if (!runOne(workerIndex))
+            std::this_thread::yield();
+    }
+}
+
+void TaskScheduler::workerLoop(int workerIndex)
+{
+    currentScheduler = this;
+    currentWorkerIndex = workerIndex;
+    while (true)
+    {
+        if (runOne(workerIndex))
+            continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        taskQueued.wait(lock, [this]() { return stopping || queuedTasks > 0; });
+        if (stopping && queuedTasks == 0)
+            return;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,998 @@
+/**
+ * @file hull_checks.cpp
+ * @brief Contains the entry point for the headless checks of the hull engines, built and run by "make check".
+ *
+ * Every engine is run on random, collinear, duplicate and vertical inputs and compared with MonotoneChainEngine, which
+ * is itself compared with an independent hull computed in double precision. The engines disagree on which points
+ * lying on an edge of the hull they keep, so every output is reduced to the corners of its own hull before it is
+ * compared, after checking that all of its points are input points.
+ *
+ * The point file formats are checked by writing and reading scratch files in the temporary directory.
+ *
+ */
+#include "approximate_hull_engine.h"
+#include "batch_hull.h"
+#include "binary_point_file.h"
+#include "chan_engine.h"
+#include "convex_layers_engine.h"
+#include "dynamic_hull.h"
+#include "hull_prefilter.h"
+#include "incremental_hull.h"
+#include "jarvis_march_engine.h"
+#include "kirk_patrick_seidel_engine.h"
+#include "monotone_chain_engine.h"
+#include "point_file_reader.h"
+#include "point_file_writer.h"
+#include "quick_hull_engine.h"
+#include "simd_kernels.h"
+#include "streaming_hull.h"
+#include "task_scheduler.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/stat.h>
+#endif
+
+/**
+ * @brief Represents an input the engines are checked on.
+ *
+ */
+struct Case
+{
+    /**
+     * @brief The name printed when a check fails.
+     *
+     */
+    std::string name;
+    /**
+     * @brief The points.
+     *
+     */
+    std::vector<Vector2> points;
+};
+
+/**
+ * @brief The number of checks that failed.
+ *
+ */
+int failureCount = 0;
+/**
+ * @brief The number of checks run.
+ *
+ */
+int checkCount = 0;
+
+/**
+ * @brief Counts a check, printing it if it failed.
+ *
+ * @param passed Whether the check passed.
+ * @param what The engine and the input checked.
+ */
+void check(bool passed, const std::string &what)
+{
+    checkCount++;
+    if (!passed)
+    {
+        failureCount++;
+        std::cout << "FAIL: " << what << "\n";
+    }
+}
+
+/**
+ * @brief Orders points by x co-ordinate, then by y co-ordinate.
+ *
+ * @param a The first point.
+ * @param b The second point.
+ * @return true If a comes before b.
+ * @return false otherwise.
+ */
+bool lessThan(Vector2 a, Vector2 b)
+{
+    return a.x < b.x || (a.x == b.x && a.y < b.y);
+}
+
+/**
+ * @brief Compares points exactly.
+ *
+ * @param a The first point.
+ * @param b The second point.
+ * @return true If the co-ordinates are equal.
+ * @return false otherwise.
+ */
+bool equal(Vector2 a, Vector2 b)
+{
+    return a.x == b.x && a.y == b.y;
+}
+
+/**
+ * @brief Computes the cross product of the vectors from o to a and from o to b in double precision, which is exact for
+ * the small integer co-ordinates of most inputs.
+ *
+ * @param o The common origin.
+ * @param a The end of the first vector.
+ * @param b The end of the second vector.
+ * @return double The cross product.
+ */
+double cross(Vector2 o, Vector2 a, Vector2 b)
+{
+    return (static_cast<double>(a.x) - o.x) * (static_cast<double>(b.y) - o.y) -
+           (static_cast<double>(a.y) - o.y) * (static_cast<double>(b.x) - o.x);
+}
+
+/**
+ * @brief Computes the corners of the hull of points, without the points lying on its edges.
+ *
+ * @param points The points.
+ * @return std::vector<Vector2> The corners, sorted with lessThan().
+ */
+std::vector<Vector2> corners(std::vector<Vector2> points)
+{
+    std::sort(points.begin(), points.end(), lessThan);
+    points.erase(std::unique(points.begin(), points.end(), equal), points.end());
+    if (points.size() <= 2)
+        return points;
+
+    std::vector<Vector2> hull(2 * points.size());
+    int k = 0;
+    for (int i = 0; i < static_cast<int>(points.size()); i++)
+    {
+        while (k >= 2 && cross(hull[k - 2], hull[k - 1], points[i]) <= 0)
+            k--;
+        hull[k++] = points[i];
+    }
+    for (int i = points.size() - 2, lowerEnd = k + 1; i >= 0; i--)
+    {
+        while (k >= lowerEnd && cross(hull[k - 2], hull[k - 1], points[i]) <= 0)
+            k--;
+        hull[k++] = points[i];
+    }
+    hull.resize(k - 1);
+    std::sort(hull.begin(), hull.end(), lessThan);
+    return hull;
+}
+
+/**
+ * @brief Checks that every point of an output is an input point.
+ *
+ * @param output The points output by an engine.
+ * @param sortedInput The input points, sorted with lessThan().
+ * @return true If every point is an input point.
+ * @return false otherwise.
+ */
+bool isSubset(const std::vector<Vector2> &output, const std::vector<Vector2> &sortedInput)
+{
+    for (Vector2 p : output)
+    {
+        if (!std::binary_search(sortedInput.begin(), sortedInput.end(), p, lessThan))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Computes all the points on the boundary of the hull of points, the points lying on its edges included.
+ *
+ * @param points The points.
+ * @return std::vector<Vector2> The distinct points on the boundary, in clockwise order with y pointing up from the
+ * smallest one, or in sorted order if they are all on a line.
+ */
+std::vector<Vector2> boundary(std::vector<Vector2> points)
+{
+    std::sort(points.begin(), points.end(), lessThan);
+    points.erase(std::unique(points.begin(), points.end(), equal), points.end());
+    if (corners(points).size() <= 2)
+        return points;
+
+    // the monotone chain goes counter-clockwise, and only drops the points that turn clockwise
+    std::vector<Vector2> hull(2 * points.size());
+    int k = 0;
+    for (int i = 0; i < static_cast<int>(points.size()); i++)
+    {
+        while (k >= 2 && cross(hull[k - 2], hull[k - 1], points[i]) < 0)
+            k--;
+        hull[k++] = points[i];
+    }
+    for (int i = points.size() - 2, lowerEnd = k + 1; i >= 0; i--)
+    {
+        while (k >= lowerEnd && cross(hull[k - 2], hull[k - 1], points[i]) < 0)
+            k--;
+        hull[k++] = points[i];
+    }
+    hull.resize(k - 1);
+    std::reverse(hull.begin() + 1, hull.end());
+    return hull;
+}
+
+/**
+ * @brief Checks the hull output by an engine against the reference corners.
+ *
+ * @param engine The name of the engine.
+ * @param testCase The input.
+ * @param sortedInput The input points, sorted with lessThan().
+ * @param reference The corners of the hull of the input.
+ * @param output The points output by the engine.
+ */
+void checkHull(const std::string &engine, const Case &testCase, const std::vector<Vector2> &sortedInput,
+               const std::vector<Vector2> &reference, const std::vector<Vector2> &output)
+{
+    std::string what = engine + " on " + testCase.name;
+    check(isSubset(output, sortedInput), what + ": outputs a point that is not an input point");
+    std::vector<Vector2> found = corners(output);
+    check(found.size() == reference.size() && std::equal(found.begin(), found.end(), reference.begin(), equal),
+          what + ": " + std::to_string(found.size()) + " corners instead of " + std::to_string(reference.size()));
+}
+
+/**
+ * @brief Computes the distance from a point to the edges of a polygon.
+ *
+ * @param polygon The corners of a convex polygon, in either order around it.
+ * @param p The point.
+ * @return double The distance.
+ */
+double distanceToBoundary(const std::vector<Vector2> &polygon, Vector2 p)
+{
+    double best = INFINITY;
+    for (int i = 0; i < static_cast<int>(polygon.size()); i++)
+    {
+        Vector2 a = polygon[i], b = polygon[(i + 1) % polygon.size()];
+        double dx = b.x - a.x, dy = b.y - a.y, length = dx * dx + dy * dy;
+        double t = length == 0 ? 0 : std::clamp(((p.x - a.x) * dx + (p.y - a.y) * dy) / length, 0.0, 1.0);
+        best = std::min(best, std::hypot(p.x - a.x - t * dx, p.y - a.y - t * dy));
+    }
+    return best;
+}
+
+/**
+ * @brief Computes the distance from a point to a polygon, 0 inside it.
+ *
+ * @param polygon The corners of a convex polygon, in either order around it.
+ * @param p The point.
+ * @return double The distance.
+ */
+double distanceToPolygon(const std::vector<Vector2> &polygon, Vector2 p)
+{
+    bool inside = polygon.size() > 2;
+    double side = 0;
+    for (int i = 0; i < static_cast<int>(polygon.size()); i++)
+    {
+        double c = cross(polygon[i], polygon[(i + 1) % polygon.size()], p);
+        if (c != 0)
+        {
+            if (side != 0 && (c > 0) != (side > 0))
+                inside = false;
+            side = c;
+        }
+    }
+    return inside ? 0 : distanceToBoundary(polygon, p);
+}
+
+/**
+ * @brief Builds the inputs.
+ *
+ * @return std::vector<Case> The inputs.
+ */
+std::vector<Case> makeCases()
+{
+    std::mt19937 random(2024);
+    std::vector<Case> cases;
+    auto uniform = [&](int n, int range) {
+        std::uniform_int_distribution<int> coordinate(-range, range);
+        std::vector<Vector2> points(n);
+        for (Vector2 &p : points)
+            p = {static_cast<float>(coordinate(random)), static_cast<float>(coordinate(random))};
+        return points;
+    };
+
+    cases.push_back({"no points", {}});
+    cases.push_back({"one point", {{3, 4}}});
+    cases.push_back({"two points", {{3, 4}, {-1, 2}}});
+    cases.push_back({"a triangle", {{0, 0}, {4, 0}, {0, 3}}});
+    for (int n : {10, 100, 1000, 100000})
+        cases.push_back({std::to_string(n) + " random points", uniform(n, 1000)});
+    cases.push_back({"200000 random points in a small range", uniform(200000, 50)});
+
+    std::vector<Vector2> diagonal, horizontal, square;
+    for (int i = 0; i < 500; i++)
+    {
+        int x = static_cast<int>(random() % 1000);
+        diagonal.push_back({static_cast<float>(x), static_cast<float>(2 * x + 1)});
+        horizontal.push_back({static_cast<float>(x), 7.0f});
+        square.push_back({static_cast<float>(x % 4 == 0 ? 0 : x % 4 == 1 ? 999 : x), static_cast<float>(x % 2) * 999});
+    }
+    cases.push_back({"collinear points on a diagonal", diagonal});
+    cases.push_back({"collinear points on a horizontal line", horizontal});
+    cases.push_back({"points on the edges of a rectangle", square});
+
+    std::vector<Vector2> duplicates;
+    std::vector<Vector2> distinct = uniform(12, 100);
+    for (int i = 0; i < 5000; i++)
+        duplicates.push_back(distinct[random() % distinct.size()]);
+    cases.push_back({"12 points with many copies", duplicates});
+
+    // points sharing the smallest or largest x co-ordinate, many of them copies, are merged separately by the
+    // Kirkpatrick-Seidel engine
+    cases.push_back(
+        {"copies on a vertical line", {{0, 2}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 3}, {0, 2}, {0, 1}, {0, 2}}});
+    std::vector<Vector2> vertical, twoVertical, copies;
+    for (int i = 0; i < 500; i++)
+    {
+        vertical.push_back({3.0f, static_cast<float>(random() % 20)});
+        twoVertical.push_back({i % 2 == 0 ? -5.0f : 5.0f, static_cast<float>(random() % 10)});
+    }
+    for (int i = 0; i < 100; i++)
+        copies.push_back({5, -5});
+    cases.push_back({"many copies on a vertical line", vertical});
+    cases.push_back({"many copies on two vertical lines", twoVertical});
+    cases.push_back({"copies of a single point", copies});
+    return cases;
+}
+
+/**
+ * @brief Checks every engine that computes the hull of a whole set of points.
+ *
+ * @param testCase The input.
+ */
+void checkEngines(const Case &testCase)
+{
+    const std::vector<Vector2> &points = testCase.points;
+    std::vector<Vector2> sortedInput = points;
+    std::sort(sortedInput.begin(), sortedInput.end(), lessThan);
+    std::vector<Vector2> reference = corners(points);
+    auto checkEngine = [&](const std::string &engine, const std::vector<Vector2> &output) {
+        checkHull(engine, testCase, sortedInput, reference, output);
+    };
+
+    checkEngine("MonotoneChainEngine", MonotoneChainEngine<NoRecord>(points).getConvexHull());
+    checkEngine("MonotoneChainEngine in parallel", MonotoneChainEngine<NoRecord>(points, 64).getConvexHull());
+    if (points.size() <= 100000)
+        checkEngine("JarvisMarchEngine", JarvisMarchEngine<NoRecord>(points).getConvexHull());
+    checkEngine("KirkpatrickSeidelEngine", KirkpatrickSeidelEngine<NoRecord>(points).getConvexHull());
+    checkEngine("KirkpatrickSeidelEngine in parallel", KirkpatrickSeidelEngine<NoRecord>(points, 64).getConvexHull());
+    checkEngine("ChanEngine", ChanEngine<NoRecord>(points).getConvexHull());
+    checkEngine("QuickHullEngine", QuickHullEngine<NoRecord>(points).getConvexHull());
+    std::vector<Vector2> collinear = QuickHullEngine<NoRecord>(points, true).getConvexHull();
+    checkEngine("QuickHullEngine keeping collinear points", collinear);
+    std::vector<Vector2> expected = boundary(points);
+    check(collinear.size() == expected.size() && std::equal(expected.begin(), expected.end(), collinear.begin(), equal),
+          "QuickHullEngine keeping collinear points on " + testCase.name + ": " + std::to_string(collinear.size()) +
+              " points on the boundary instead of " + std::to_string(expected.size()));
+    checkEngine("QuickHullEngine in parallel", QuickHullEngine<NoRecord>(points, false, 64).getConvexHull());
+
+    HullPrefilter prefilter;
+    std::vector<Vector2> kept = prefilter.filter(points);
+    checkEngine("HullPrefilter", MonotoneChainEngine<NoRecord>(kept).getConvexHull());
+    std::vector<float> xs, ys;
+    for (Vector2 p : points)
+    {
+        xs.push_back(p.x);
+        ys.push_back(p.y);
+    }
+    std::vector<Vector2> keptFromArrays = prefilter.filter(xs.data(), ys.data(), points.size());
+    check(keptFromArrays.size() == kept.size() && std::equal(kept.begin(), kept.end(), keptFromArrays.begin(), equal),
+          "HullPrefilter on " + testCase.name + ": keeps other points when given separate co-ordinate arrays");
+
+    StreamingHull streamingHull(1000);
+    for (Vector2 p : points)
+        streamingHull.add(p);
+    checkEngine("StreamingHull", streamingHull.getConvexHull());
+
+    // the corners of the approximate hull lie on the edges of the exact hull, which is within the error bound of it
+    ApproximateHullEngine<NoRecord> approximate(points, 64);
+    std::vector<Vector2> approximateCorners = corners(approximate.getConvexHull());
+    std::vector<Vector2> exactHull = MonotoneChainEngine<NoRecord>(reference).getConvexHull();
+    bool onEdges = true;
+    for (Vector2 corner : approximateCorners)
+        onEdges &= distanceToBoundary(exactHull, corner) <= 1e-3;
+    check(isSubset(approximate.getConvexHull(), sortedInput) && onEdges,
+          "ApproximateHullEngine on " + testCase.name + ": outputs a point that is not on the edges of the hull");
+    std::vector<Vector2> polygon = MonotoneChainEngine<NoRecord>(approximateCorners).getConvexHull();
+    double error = 0;
+    for (Vector2 corner : reference)
+        error = std::max(error, distanceToPolygon(polygon, corner));
+    check(points.empty() || error <= approximate.getErrorBound() * 1.001 + 1e-3,
+          "ApproximateHullEngine on " + testCase.name + ": a corner is " + std::to_string(error) +
+              " away, more than the error bound " + std::to_string(approximate.getErrorBound()));
+}
+
+/**
+ * @brief Checks DynamicHull while points are inserted and erased.
+ *
+ * @param testCase The input.
+ */
+void checkDynamicHull(const Case &testCase)
+{
+    std::vector<Vector2> points = testCase.points;
+    std::vector<Vector2> sortedInput = points;
+    std::sort(sortedInput.begin(), sortedInput.end(), lessThan);
+    DynamicHull built(points);
+    checkHull("DynamicHull built at once", testCase, sortedInput, corners(points), built.getConvexHull());
+
+    // half of the points are inserted one at a time, then every other one of them is erased
+    DynamicHull dynamicHull;
+    std::vector<Vector2> inserted(points.begin(), points.begin() + points.size() / 2);
+    for (Vector2 p : inserted)
+        dynamicHull.insert(p);
+    checkHull("DynamicHull after insertions", testCase, sortedInput, corners(inserted), dynamicHull.getConvexHull());
+    std::vector<Vector2> kept;
+    bool erased = true;
+    for (int i = 0; i < static_cast<int>(inserted.size()); i++)
+    {
+        if (i % 2 == 0)
+            erased &= dynamicHull.erase(inserted[i]);
+        else
+            kept.push_back(inserted[i]);
+    }
+    check(erased && dynamicHull.size() == static_cast<int>(kept.size()),
+          "DynamicHull on " + testCase.name + ": erases the wrong points");
+    checkHull("DynamicHull after erasures", testCase, sortedInput, corners(kept), dynamicHull.getConvexHull());
+}
+
+/**
+ * @brief Checks IncrementalHull while points are inserted one at a time.
+ *
+ * @param testCase The input.
+ */
+void checkIncrementalHull(const Case &testCase)
+{
+    std::vector<Vector2> sortedInput = testCase.points;
+    std::sort(sortedInput.begin(), sortedInput.end(), lessThan);
+    IncrementalHull incrementalHull;
+    for (Vector2 p : testCase.points)
+        incrementalHull.insert(p);
+    checkHull("IncrementalHull", testCase, sortedInput, corners(testCase.points), incrementalHull.getConvexHull());
+    bool contained = true;
+    for (Vector2 p : testCase.points)
+        contained &= incrementalHull.contains(p);
+    check(contained, "IncrementalHull on " + testCase.name + ": does not contain every point");
+}
+
+/**
+ * @brief Checks BatchHull on all the inputs at once, as one set each.
+ *
+ * @param cases The inputs.
+ */
+void checkBatchHull(const std::vector<Case> &cases)
+{
+    std::vector<float> xs, ys;
+    std::vector<int> offsets = {0};
+    for (const Case &testCase : cases)
+    {
+        for (Vector2 p : testCase.points)
+        {
+            xs.push_back(p.x);
+            ys.push_back(p.y);
+        }
+        offsets.push_back(xs.size());
+    }
+    BatchHull batchHull(64);
+    batchHull.compute(xs.data(), ys.data(), offsets.data(), cases.size());
+    const std::vector<int> &indices = batchHull.getIndices();
+    const std::vector<int> &hullOffsets = batchHull.getHullOffsets();
+    for (int set = 0; set < static_cast<int>(cases.size()); set++)
+    {
+        std::vector<Vector2> output;
+        bool inSet = true;
+        for (int k = hullOffsets[set]; k < hullOffsets[set + 1]; k++)
+        {
+            inSet &= indices[k] >= offsets[set] && indices[k] < offsets[set + 1];
+            output.push_back({xs[indices[k]], ys[indices[k]]});
+        }
+        std::vector<Vector2> sortedInput = cases[set].points;
+        std::sort(sortedInput.begin(), sortedInput.end(), lessThan);
+        check(inSet, "BatchHull on " + cases[set].name + ": outputs an index outside the set");
+        checkHull("BatchHull", cases[set], sortedInput, corners(cases[set].points), output);
+    }
+}
+
+/**
+ * @brief Checks that every layer of ConvexLayersEngine is the hull of the points left by the layers before it.
+ *
+ * @param testCase The input.
+ */
+void checkConvexLayers(const Case &testCase)
+{
+    ConvexLayersEngine<NoRecord> engine(testCase.points);
+    std::vector<Vector2> left = testCase.points;
+    std::sort(left.begin(), left.end(), lessThan);
+    bool peeled = true;
+    for (int layer = 0; layer < engine.getLayerCount() && peeled; layer++)
+    {
+        std::vector<Vector2> points = engine.getLayer(layer);
+        checkHull("ConvexLayersEngine layer " + std::to_string(layer), testCase, left, corners(left), points);
+
+        // all the copies of the points of the layer are removed with it
+        std::sort(points.begin(), points.end(), lessThan);
+        std::vector<Vector2> rest;
+        std::set_difference(left.begin(), left.end(), points.begin(), points.end(), std::back_inserter(rest),
+                            lessThan);
+        auto onLayer = [&](Vector2 p) { return std::binary_search(points.begin(), points.end(), p, lessThan); };
+        rest.erase(std::remove_if(rest.begin(), rest.end(), onLayer), rest.end());
+        peeled = rest.size() < left.size();
+        left = std::move(rest);
+    }
+    check(peeled && left.empty(), "ConvexLayersEngine on " + testCase.name + ": leaves points on no layer");
+}
+
+/**
+ * @brief Checks that the AVX2 and SSE4.1 versions of SimdKernels give the same results as the scalar one, both on their
+ * own and through KirkpatrickSeidelEngine, on random and nearly degenerate points.
+ *
+ */
+void checkSimdKernels()
+{
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> coordinate(-1000.0f, 1000.0f), angle(0.0f, 6.2831853f);
+    std::vector<std::pair<std::string, std::vector<Vector2>>> inputs(4);
+    inputs[0].first = "random float points";
+    inputs[1].first = "float points on a circle";
+    inputs[2].first = "float points on a line";
+    inputs[3].first = "points on a small grid";
+    for (int i = 0; i < 20000; i++)
+    {
+        float a = angle(random), x = coordinate(random);
+        inputs[0].second.push_back({x, coordinate(random)});
+        inputs[1].second.push_back({1000.0f * std::cos(a), 1000.0f * std::sin(a)});
+        inputs[2].second.push_back({x, 0.75f * x + 3.0f});
+        inputs[3].second.push_back({static_cast<float>(random() % 16), static_cast<float>(random() % 16)});
+    }
+
+    // the bits of the slopes are compared, as the slopes of vertical pairs are infinities or NaNs
+    auto sameBits = [](const std::vector<float> &a, const std::vector<float> &b) {
+        for (int i = 0; i < static_cast<int>(a.size()); i++)
+        {
+            if (std::memcmp(&a[i], &b[i], sizeof(float)) != 0 && !(std::isnan(a[i]) && std::isnan(b[i])))
+                return false;
+        }
+        return true;
+    };
+    auto run = [&](const std::vector<Vector2> &points, std::vector<int> &vertical, std::vector<float> &slopes,
+                   std::vector<std::pair<int, int>> &support) {
+        for (int n : {1, 2, 3, 7, 8, 9, 17, 31, 1000, 20000})
+        {
+            for (float ySign : {1.0f, -1.0f})
+            {
+                std::vector<float> pairSlopes(n / 2);
+                vertical.push_back(SimdKernels::pairSlopes(points.data(), n, pairSlopes.data(), ySign));
+                slopes.insert(slopes.end(), pairSlopes.begin(), pairSlopes.end());
+                for (float slope : {0.0f, 0.75f, -1.5f, n / 2 > 0 ? pairSlopes[0] : 1.0f})
+                    support.push_back(SimdKernels::supportingPoints(points.data(), n, slope, ySign));
+            }
+        }
+    };
+
+    const char *picked = SimdKernels::getInstructionSet();
+    for (const auto &[name, points] : inputs)
+    {
+        SimdKernels::useInstructionSet("scalar");
+        std::vector<int> scalarVertical;
+        std::vector<float> scalarSlopes;
+        std::vector<std::pair<int, int>> scalarSupport;
+        run(points, scalarVertical, scalarSlopes, scalarSupport);
+        std::vector<Vector2> scalarHull = KirkpatrickSeidelEngine<NoRecord>(points).getConvexHull();
+
+        for (const char *instructionSet : {"sse4.1", "avx2"})
+        {
+            if (!SimdKernels::useInstructionSet(instructionSet))
+                continue;
+            std::vector<int> vertical;
+            std::vector<float> slopes;
+            std::vector<std::pair<int, int>> support;
+            run(points, vertical, slopes, support);
+            std::vector<Vector2> hull = KirkpatrickSeidelEngine<NoRecord>(points).getConvexHull();
+            std::string what = std::string("SimdKernels with ") + instructionSet + " on " + name;
+            check(vertical == scalarVertical && sameBits(slopes, scalarSlopes),
+                  what + ": the pair slopes differ from the scalar ones");
+            check(support == scalarSupport, what + ": the supporting points differ from the scalar ones");
+            check(hull.size() == scalarHull.size() && std::equal(hull.begin(), hull.end(), scalarHull.begin(), equal),
+                  what + ": the KirkpatrickSeidelEngine hull differs from the scalar one");
+        }
+    }
+    SimdKernels::useInstructionSet(picked);
+}
+
+/**
+ * @brief Checks that QuickHullEngine keeps the same points on the edges of the hull as KirkpatrickSeidelEngine, but
+ * for the inner points of the vertical edge at the largest x co-ordinate, which only QuickHullEngine keeps.
+ *
+ */
+void checkCollinearLikeKirkpatrickSeidel()
+{
+    // the lattice points of a polygon with collinear points on every edge and vertical edges at both ends
+    std::vector<Vector2> points;
+    for (int x = 0; x <= 6; x++)
+    {
+        for (int y = std::max(0, x - 3); y <= 8; y++)
+            points.push_back({static_cast<float>(x), static_cast<float>(y)});
+    }
+    std::vector<Vector2> quickHull = QuickHullEngine<NoRecord>(points, true).getConvexHull();
+    std::vector<Vector2> kirkpatrickSeidel = KirkpatrickSeidelEngine<NoRecord>(points).getConvexHull();
+
+    // both go clockwise around the hull, from different points
+    std::rotate(kirkpatrickSeidel.begin(),
+                std::min_element(kirkpatrickSeidel.begin(), kirkpatrickSeidel.end(), lessThan),
+                kirkpatrickSeidel.end());
+    std::vector<Vector2> expected;
+    for (Vector2 p : quickHull)
+    {
+        if (p.x != 6 || p.y == 3 || p.y == 8)
+            expected.push_back(p);
+    }
+    check(quickHull.size() == expected.size() + 4 && kirkpatrickSeidel.size() == expected.size() &&
+              std::equal(expected.begin(), expected.end(), kirkpatrickSeidel.begin(), equal),
+          "QuickHullEngine keeping collinear points: keeps other points than KirkpatrickSeidelEngine");
+}
+
+/**
+ * @brief Checks that ChanEngine finds every tangent in O(log m) on an input whose points are all on the hull, where
+ * the point being wrapped from is on a mini hull at every step.
+ *
+ */
+void checkChanTangents()
+{
+    const int n = 20000;
+    std::vector<Vector2> points;
+    for (int i = 0; i < n; i++)
+    {
+        double angle = 2 * M_PI * i / n;
+        points.push_back({static_cast<float>(1000 * std::cos(angle)), static_cast<float>(1000 * std::sin(angle))});
+    }
+    std::vector<Vector2> sortedInput = points;
+    std::sort(sortedInput.begin(), sortedInput.end(), lessThan);
+    Case testCase = {"20000 points on a circle", points};
+    ChanEngine<NoRecord> engine(points);
+    checkHull("ChanEngine", testCase, sortedInput, corners(points), engine.getConvexHull());
+
+    // every guess wraps at most m points and finds a tangent on each of its n / m mini hulls from every one of them
+    long long bound = 0;
+    for (long long m : {4LL, 16LL, 256LL, static_cast<long long>(n)})
+        bound += std::min<long long>(m, n) * ((n + m - 1) / m) * (std::log2(m) + 2);
+    check(engine.getTangentProbes() <= bound, "ChanEngine on " + testCase.name + ": looked at " +
+                                                  std::to_string(engine.getTangentProbes()) +
+                                                  " points to find the tangents, more than " + std::to_string(bound));
+}
+
+/**
+ * @brief Checks that KirkpatrickSeidelEngine stops when its cancellation flag is set, and runs to the end otherwise.
+ *
+ * @param testCase The input.
+ */
+void checkCancellation(const Case &testCase)
+{
+    std::atomic<bool> cancelled{true}, running{false};
+    KirkpatrickSeidelEngine<NoRecord> stopped(testCase.points, 64, &cancelled);
+    // up to two points are returned as they are, without any recursion to stop
+    check(stopped.isCancelled() && (testCase.points.size() <= 2 || stopped.getConvexHull().empty()),
+          "KirkpatrickSeidelEngine on " + testCase.name + ": computes a hull after being cancelled");
+    KirkpatrickSeidelEngine<NoRecord> finished(testCase.points, 64, &running);
+    std::vector<Vector2> expected = KirkpatrickSeidelEngine<NoRecord>(testCase.points, 64).getConvexHull();
+    check(!finished.isCancelled() && finished.getConvexHull().size() == expected.size() &&
+              std::equal(expected.begin(), expected.end(), finished.getConvexHull().begin(), equal),
+          "KirkpatrickSeidelEngine on " + testCase.name + ": computes a different hull with a cancellation flag");
+}
+
+/**
+ * @brief Gets the path of a scratch file in the temporary directory.
+ *
+ * @param name The name of the file.
+ * @return std::string The path.
+ */
+std::string scratchPath(const std::string &name)
+{
+    return (std::filesystem::temp_directory_path() / ("hull_checks_" + name)).string();
+}
+
+/**
+ * @brief Replaces the contents of a file.
+ *
+ * @param filePath The path to the file.
+ * @param contents The new contents.
+ */
+void writeFile(const std::string &filePath, const std::string &contents)
+{
+    std::ofstream ostream(filePath, std::ios::binary | std::ios::trunc);
+    ostream << contents;
+}
+
+/**
+ * @brief Reads all the points of a file with PointFileReader::readAll().
+ *
+ * @param filePath The path to the file.
+ * @param points Set to the points read.
+ * @param error Set to the error of the reader.
+ * @return true If the whole file was read.
+ * @return false otherwise.
+ */
+bool readAllPoints(const std::string &filePath, std::vector<Vector2> &points, std::string &error)
+{
+    PointFileReader reader;
+    points.clear();
+    bool read = reader.open(filePath) && reader.readAll(points);
+    error = reader.getError();
+    return read;
+}
+
+/**
+ * @brief Reads all the points of a file with PointFileReader::read(), a few at a time.
+ *
+ * @param filePath The path to the file.
+ * @param points Set to the points read.
+ * @param error Set to the error of the reader.
+ * @return true If the whole file was read.
+ * @return false otherwise.
+ */
+bool readPointsInPieces(const std::string &filePath, std::vector<Vector2> &points, std::string &error)
+{
+    PointFileReader reader;
+    points.clear();
+    if (!reader.open(filePath))
+    {
+        error = reader.getError();
+        return false;
+    }
+    Vector2 piece[1000];
+    for (int count = 1000; count == 1000;)
+    {
+        count = reader.read(piece, 1000);
+        points.insert(points.end(), piece, piece + count);
+    }
+    error = reader.getError();
+    return error.empty();
+}
+
+/**
+ * @brief Checks that PointFileReader reads text files with every kind of white space, in parallel chunks or a piece at
+ * a time, and reports the line where a file stops following the format.
+ *
+ */
+void checkPointFileReader()
+{
+    std::string filePath = scratchPath("points.txt");
+    std::vector<Vector2> points;
+    std::string error;
+
+    writeFile(filePath, "  (1, 2)\r\n\t( -3.5 ,+4e1 )(5,6)\n\n");
+    check(readAllPoints(filePath, points, error) && points.size() == 3 && equal(points[1], {-3.5f, 40}) &&
+              equal(points[2], {5, 6}),
+          "PointFileReader: reads points with white space, signs and exponents");
+
+    // every error is reported on the line where it is found, with the points before it
+    struct InvalidText
+    {
+        std::string contents, message;
+        size_t pointCount;
+    } errors[] = {
+        {"(1, 2)\n(3, 4)\n\n(5 6)\n", ":4: expected ',', found '6'", 2},
+        {"(1,2)\n(3,", ":2: expected the y co-ordinate, found the end of the file", 1},
+        {"(1,2) x", ":1: expected '(', found 'x'", 1},
+        {"(1,2)\n(3,4\n(5,6)", ":3: expected ')', found '('", 1},
+    };
+    for (auto &[contents, message, pointCount] : errors)
+    {
+        writeFile(filePath, contents);
+        bool read = readAllPoints(filePath, points, error);
+        check(!read && error == filePath + message && points.size() == pointCount,
+              "PointFileReader: reports \"" + error + "\" instead of \"" + filePath + message + "\"");
+        read = readPointsInPieces(filePath, points, error);
+        check(!read && error == filePath + message,
+              "PointFileReader reading in pieces: reports \"" + error + "\" instead of \"" + filePath + message + "\"");
+    }
+
+    // a file of several chunks, cut between points, is read whole, and an error in its last chunk gets its line
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int> coordinate(-100000, 100000);
+    std::vector<Vector2> expected;
+    std::string text;
+    while (text.size() < 2 * PointFileReader::CHUNK_SIZE + 1000)
+    {
+        Vector2 p = {static_cast<float>(coordinate(random)), static_cast<float>(coordinate(random))};
+        expected.push_back(p);
+        text += "(" + std::to_string(static_cast<int>(p.x)) + ", " + std::to_string(static_cast<int>(p.y)) + ")\n";
+    }
+    writeFile(filePath, text);
+    check(readAllPoints(filePath, points, error) && points.size() == expected.size() &&
+              std::equal(expected.begin(), expected.end(), points.begin(), equal),
+          "PointFileReader: reads a file of several chunks");
+    check(readPointsInPieces(filePath, points, error) && points.size() == expected.size() &&
+              std::equal(expected.begin(), expected.end(), points.begin(), equal),
+          "PointFileReader reading in pieces: reads a file of several chunks");
+
+    size_t lastLine = text.rfind('\n', text.size() - 2) + 1;
+    std::string broken = text.substr(0, lastLine) + "(1; 2)\n";
+    std::string message = filePath + ":" + std::to_string(expected.size()) + ": expected ',', found ';'";
+    writeFile(filePath, broken);
+    check(!readAllPoints(filePath, points, error) && error == message && points.size() == expected.size() - 1,
+          "PointFileReader: reports \"" + error + "\" instead of \"" + message + "\" in the last chunk");
+
+#if !defined(_WIN32)
+    // a pipe cannot be mapped, so it is read a block at a time, with points and lines going across the blocks
+    std::string pipePath = scratchPath("points.pipe");
+    std::remove(pipePath.c_str());
+    if (mkfifo(pipePath.c_str(), 0600) == 0)
+    {
+        for (const std::string &contents : {text, broken})
+        {
+            std::thread writer([&]() { writeFile(pipePath, contents); });
+            bool read = readPointsInPieces(pipePath, points, error);
+            writer.join();
+            if (contents == text)
+                check(read && points.size() == expected.size() &&
+                          std::equal(expected.begin(), expected.end(), points.begin(), equal),
+                      "PointFileReader reading a pipe in pieces: reads other points than from the file");
+            else
+                check(!read && error == pipePath + message.substr(filePath.size()),
+                      "PointFileReader reading a pipe in pieces: reports \"" + error + "\" in the last block");
+        }
+        std::remove(pipePath.c_str());
+    }
+#endif
+    std::remove(filePath.c_str());
+}
+
+/**
+ * @brief Checks that BinaryPointFile gives back the points and the hull written to it, and rejects files whose header
+ * does not agree with their contents.
+ *
+ */
+void checkBinaryPointFile()
+{
+    std::string filePath = scratchPath("points.bin");
+    std::mt19937 random(11);
+    std::uniform_real_distribution<float> coordinate(-1000, 1000);
+    std::vector<Vector2> points(1000);
+    for (Vector2 &p : points)
+        p = {coordinate(random), coordinate(random)};
+    std::vector<Vector2> hull = MonotoneChainEngine<NoRecord>(points).getConvexHull();
+    std::string error;
+    check(BinaryPointFile::write(filePath, points, hull, error), "BinaryPointFile: " + error);
+
+    BinaryPointFile file;
+    bool opened = file.open(filePath);
+    check(opened && file.getCount() == static_cast<long long>(points.size()) &&
+              file.getCoordinateType() == BinaryPointFile::FLOAT32,
+          "BinaryPointFile: the header does not hold the number and type of the points written");
+    if (opened)
+    {
+        Vector2 min = points[0], max = points[0];
+        bool same = true;
+        for (int i = 0; i < static_cast<int>(points.size()); i++)
+        {
+            min = {std::min(min.x, points[i].x), std::min(min.y, points[i].y)};
+            max = {std::max(max.x, points[i].x), std::max(max.y, points[i].y)};
+            same &= file.getXs()[i] == points[i].x && file.getYs()[i] == points[i].y;
+        }
+        std::vector<Vector2> read(points.size());
+        file.readPoints(0, points.size(), read.data());
+        std::vector<Vector2> storedHull = file.getHull();
+        check(same && std::equal(points.begin(), points.end(), read.begin(), equal),
+              "BinaryPointFile: reads other points than were written");
+        check(equal(file.getMin(), min) && equal(file.getMax(), max),
+              "BinaryPointFile: the bounding box is not that of the points");
+        check(file.hasHull() && storedHull.size() == hull.size() &&
+                  std::equal(hull.begin(), hull.end(), storedHull.begin(), equal),
+              "BinaryPointFile: reads another hull than was written");
+    }
+    std::vector<Vector2> read;
+    check(readAllPoints(filePath, read, error) && read.size() == points.size() &&
+              std::equal(points.begin(), points.end(), read.begin(), equal),
+          "PointFileReader: reads other points from a binary point file than were written");
+    check(BinaryPointFile::write(filePath, points, {}, error) && file.open(filePath) && !file.hasHull() &&
+              file.getHull().empty(),
+          "BinaryPointFile: reads a hull from a file written without one");
+
+    // every field of the header is checked against the size of the file
+    std::ifstream istream(filePath, std::ios::binary);
+    std::string valid((std::istreambuf_iterator<char>(istream)), std::istreambuf_iterator<char>());
+    auto withField = [&](size_t offset, uint64_t value, size_t size) {
+        std::string contents = valid;
+        std::memcpy(contents.data() + offset, &value, size);
+        return contents;
+    };
+    uint64_t pastEnd = valid.size() + 8;
+    std::pair<std::string, std::string> invalid[] = {
+        {valid.substr(0, 40), "too small for the header of a binary point file"},
+        {withField(0, 0x46504843 + 1, 4), "not a binary point file"},
+        {withField(4, BinaryPointFile::VERSION + 1, 4), "unsupported version of the binary point format"},
+        {withField(16, 3, 4), "unknown co-ordinate type"},
+        {withField(8, points.size() + 1, 8), "the file is shorter than its points"},
+        {withField(16, BinaryPointFile::FLOAT64, 4), "the file is shorter than its points"},
+        {withField(56, pastEnd, 8), "the precomputed hull lies outside the file"},
+        {withField(56, BinaryPointFile::HEADER_SIZE, 8), "the precomputed hull lies outside the file"},
+    };
+    for (auto &[contents, reason] : invalid)
+    {
+        writeFile(filePath, contents);
+        check(!file.open(filePath) && file.getError() == filePath + ": " + reason,
+              "BinaryPointFile: reports \"" + file.getError() + "\" instead of \"" + reason + "\"");
+    }
+    file.close();
+    std::remove(filePath.c_str());
+}
+
+/**
+ * @brief Checks the text written by PointFileWriter in every format, and that PointFileReader reads it back.
+ *
+ */
+void checkPointFileWriter()
+{
+    std::vector<Vector2> points = {{1.5f, -2}, {0.1f, 3}, {-0.25f, 1e6f}};
+    auto text = [](const PointFileWriter &writer) { return std::string(writer.getData(), writer.getSize()); };
+
+    PointFileWriter shortest;
+    shortest.addPoints(points);
+    shortest.addBlankLine();
+    shortest.addPoint({7, 8});
+    check(text(shortest) == "(1.5,-2)\n(0.1,3)\n(-0.25,1000000)\n\n(7,8)\n",
+          "PointFileWriter: writes \"" + text(shortest) + "\" in the shortest text form");
+
+    PointFileWriter csv(PointFileWriter::CSV, 2);
+    csv.addPoints(points);
+    check(text(csv) == "x,y\n1.50,-2.00\n0.10,3.00\n-0.25,1000000.00\n",
+          "PointFileWriter: writes \"" + text(csv) + "\" as CSV with 2 digits");
+    csv.clear();
+    check(text(csv) == "x,y\n", "PointFileWriter: drops the CSV header when cleared");
+
+    PointFileWriter rounded(PointFileWriter::TEXT, 0);
+    rounded.addPoints(points);
+    check(text(rounded) == "(2,-2)\n(0,3)\n(-0,1000000)\n",
+          "PointFileWriter: writes \"" + text(rounded) + "\" with no digits");
+
+    // the shortest form reads back to the same floats
+    std::string filePath = scratchPath("written.txt");
+    std::mt19937 random(13);
+    std::uniform_real_distribution<float> coordinate(-1e7f, 1e7f);
+    std::vector<Vector2> written(1000);
+    for (Vector2 &p : written)
+        p = {coordinate(random), coordinate(random) * 1e-9f};
+    PointFileWriter writer;
+    writer.addPoints(written);
+    std::vector<Vector2> read;
+    std::string error;
+    check(writer.save(filePath) && readAllPoints(filePath, read, error) && read.size() == written.size() &&
+              std::equal(written.begin(), written.end(), read.begin(), equal),
+          "PointFileWriter: writes points that read back to other values");
+    std::remove(filePath.c_str());
+}
+
+/**
+ * @brief Program main entry point.
+ *
+ * @return int 0 if every check passed, 1 otherwise.
+ */
+int main()
+{
+    // several workers are used even on a single core, so that the parallel paths are taken
+    TaskScheduler::setSharedThreadCount(4);
+    std::vector<Case> cases = makeCases();
+    for (const Case &testCase : cases)
+    {
+        checkEngines(testCase);
+        checkDynamicHull(testCase);
+        checkIncrementalHull(testCase);
+        checkCancellation(testCase);
+        if (testCase.points.size() <= 2000)
+            checkConvexLayers(testCase);
+    }
+    checkBatchHull(cases);
+    checkSimdKernels();
+    checkCollinearLikeKirkpatrickSeidel();
+    checkChanTangents();
+    checkPointFileReader();
+    checkBinaryPointFile();
+    checkPointFileWriter();
+
+    std::cout << checkCount - failureCount << " of " << checkCount << " checks passed\n";
+    return failureCount == 0 ? 0 : 1;
+}
\ No newline at end of file